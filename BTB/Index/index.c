@@ -1,184 +1,280 @@
-#define _GNU_SOURCE
-
-#include <err.h>
-#include <fcntl.h>
-#include <gelf.h>
-#include <libelf.h>
-#include <sched.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
-#include <string.h>
-#include <sys/mman.h>
-#include <time.h>
 #include <unistd.h>
 
-#define TRIALS 10000
+#include "arena.h"
+#include "bpure.h"
+#include "elfcache.h"
+#include "measure.h"
+#include "perturb.h"
+#include "refine.h"
+#include "sink.h"
+#include "store.h"
+#include "timer.h"
+#include "trials.h"
+#include "workers.h"
+
 #define TARGET_ADDRESS 0x10000000   // mmap needs the address to be aligned to a page boundary
-#define MAX_FUNC_PTR_NUM 17
+#define MAX_FUNC_PTR_NUM 64
+#define DEFAULT_COPIES 17
+#define MAX_RANGE_LEN 64
+#define DEFAULT_INDEX_BITS "4..26"
 void (*perform_branch[MAX_FUNC_PTR_NUM])();
+struct timer timer;
+struct overhead overhead;
+struct perturb perturb;
+struct trials tc;
+struct code_arena arena;
+const struct elf_span *func;
+int index_bits[MAX_RANGE_LEN];
+const char *timer_name = "auto";
+const char *perturb_mode = "sw";
+int copies = DEFAULT_COPIES;
+struct sink sink;
+struct store store;
+struct refine refine;
+int col_index_bits, col_cpu, col_trials, col_mean, col_ci, col_net;
+int worker_cpu;
 
-void load_function(const char *filename, const char *func_name, int index_bits)
+uint64_t measure_branch_time(int iterations)
 {
-    if (elf_version(EV_CURRENT) == EV_NONE)
-    {
-        fprintf(stderr, "ELF library initialization failed: %s\n", elf_errmsg(-1));
-        exit(EXIT_FAILURE);
-    }
+    uint64_t start_time, end_time, total_time = 0;
 
-    int fd = open(filename, O_RDONLY);
-    if (fd < 0)
+    for (int i = 0; i < iterations; i++)
     {
-        perror("open");
-        exit(EXIT_FAILURE);
+        start_time = timer_read(&timer);
+        #pragma GCC unroll 64
+        for (int j = 0; j < copies; j++)
+            perform_branch[j]();
+        end_time = timer_read(&timer);
+        total_time += end_time - start_time;
     }
 
-    Elf *e = elf_begin(fd, ELF_C_READ, NULL);
-    if (!e)
+    return total_time;
+}
+
+uint64_t measure_window(void *ctx)
+{
+    return measure_branch_time(1);
+}
+
+// Per worker: everything that depends on the core it runs on
+void setup(int cpu, void *ctx)
+{
+    worker_cpu = cpu;
+
+    // Drop trials that a context switch, migration, page fault or interrupt landed in
+    perturb_open(&perturb, perturb_mode, cpu);
+
+    // Calibrate the timer on the CPU it will be read on
+    timer_open_named(&timer, timer_name);
+    timer_report(&timer, stdout);
+
+    // Time the same calls through the pointers with empty gadgets in place of the branches
+    for (int j = 0; j < copies; j++)
+        perform_branch[j] = (void (*)())empty_gadget();
+    overhead_calibrate(&overhead, measure_window, NULL, OVERHEAD_SAMPLES);
+    overhead_report(&overhead, &timer, stdout);
+}
+
+void run_point(int point, void *ctx)
+{
+    size_t stride = (size_t)1 << index_bits[point];
+
+    if (store_lookup(&store, &sink, "index_bits=%d", index_bits[point]))
     {
-        fprintf(stderr, "elf_begin() failed: %s\n", elf_errmsg(-1));
-        close(fd);
-        exit(EXIT_FAILURE);
+        refine_record(&refine, point, sink.row[col_mean].f, sink.row[col_ci].f);
+        return;
     }
 
-    Elf_Scn *scn = NULL;
-    GElf_Shdr shdr;
-    while ((scn = elf_nextscn(e, scn)) != NULL)
+    // Copies that do not move are neither rewritten nor flushed
+    arena_reset(&arena);
+    for (int j = 0; j < copies; j++)
+        perform_branch[j] = (void (*)())arena_place(&arena, j * stride, func->code, func->size);
+    arena_trim(&arena);
+
+    // Measure the time taken for branches until the mean is known to rel_err
+    struct welford w;
+    long attempts = 0;
+    welford_init(&w);
+    while (!trials_done(&tc, &w) && !perturb_give_up(&perturb, &attempts, trials_max_attempts(&tc)))
     {
-        gelf_getshdr(scn, &shdr);
-        if (shdr.sh_type == SHT_SYMTAB)
-        {
-            Elf_Data *data = elf_getdata(scn, NULL);
-            int count = shdr.sh_size / shdr.sh_entsize;
-            for (int i = 0; i < count; ++i)
-            {
-                GElf_Sym sym;
-                gelf_getsym(data, i, &sym);
-                if (strcmp(func_name, elf_strptr(e, shdr.sh_link, sym.st_name)) == 0)
-                {
-                    // printf("Symbol name: %s\n", func_name);
-                    // printf("Symbol size: %zu\n", sym.st_size);
-
-                    // Find the section containing the symbol
-                    Elf_Scn *sym_scn = elf_getscn(e, sym.st_shndx);
-                    GElf_Shdr sym_shdr;
-                    gelf_getshdr(sym_scn, &sym_shdr);
-
-                    // Calculate the file offset of the symbol
-                    off_t offset = sym_shdr.sh_offset + (sym.st_value - sym_shdr.sh_addr);
-                    // printf("Symbol offset: %ld\n", offset);
-
-                    // Calculate the memory we need to put all the functions
-                    size_t size = (1 << index_bits) * MAX_FUNC_PTR_NUM;
-                    size = (size + 0xfff) & ~0xfff; // Align to page size
-                    void *mem = mmap((void *)TARGET_ADDRESS, size, PROT_READ | PROT_WRITE | PROT_EXEC,
-                                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
-                    if (mem == MAP_FAILED)
-                    {
-                        perror("mmap");
-                        elf_end(e);
-                        close(fd);
-                        exit(EXIT_FAILURE);
-                    }
-                    memset(mem, 0, size);
-
-                    lseek(fd, offset, SEEK_SET);
-                    ssize_t bytes_read = read(fd, mem, sym.st_size);
-                    if (bytes_read != sym.st_size)
-                    {
-                        fprintf(stderr, "Failed to read function code: expected %zu bytes, got %zd bytes\n", sym.st_size, bytes_read);
-                        elf_end(e);
-                        close(fd);
-                        exit(EXIT_FAILURE);
-                    }
-
-                    /*
-                    printf("Read content:\n");
-                    for (ssize_t j = 0; j < bytes_read; ++j)
-                    {
-                        printf("%02x ", ((unsigned char *)mem)[j]);
-                    }
-                    printf("\n");
-                    */
-
-                    perform_branch[0] = (void (*)())mem;
-                    // Clear instruction cache
-                    __builtin___clear_cache(mem, (char *)mem + sym.st_size);
-
-                    for (int j = 1; j < MAX_FUNC_PTR_NUM; j++)
-                    {
-                        memcpy((char *)mem + j * (1 << index_bits), mem, sym.st_size);
-                        perform_branch[j] = (void (*)())((char *)mem + j * (1 << index_bits));
-                        // Clear instruction cache
-                        __builtin___clear_cache((char *)mem + j * (1 << index_bits), (char *)mem + j * (1 << index_bits) + sym.st_size);
-                    }
-
-                    break;
-                }
-            }
-            break;
-        }
-    }
+        struct perturb_counts perturbation;
 
-    elf_end(e);
-    close(fd);
-}
+        perturb_begin(&perturb, &perturbation);
+        uint64_t window = measure_branch_time(1);
+        if (!perturb_end(&perturb, &perturbation))
+            welford_add(&w, window);
+    }
+    double net = overhead_net(&overhead, w.mean) / copies;
+    store_printf(&store, "Index bits: %d, Average time taken for branch: %f, Net time per branch: %f, Trials: %ld\n",
+                 index_bits[point], w.mean, net, w.n);
 
-// Function to bind the process to a specific CPU
-void bind_to_cpu(int cpu)
-{
-    cpu_set_t set;
-    CPU_ZERO(&set);
-    CPU_SET(cpu, &set);
-    if (sched_setaffinity(0, sizeof(set), &set) < 0)
-        err(EXIT_FAILURE, "Unable to set CPU affinity");
+    sink_int(&sink, col_index_bits, index_bits[point]);
+    sink_int(&sink, col_cpu, worker_cpu);
+    sink_int(&sink, col_trials, w.n);
+    sink_float(&sink, col_mean, w.mean);
+    sink_float(&sink, col_ci, welford_ci(&w));
+    sink_float(&sink, col_net, net);
+    refine_record(&refine, point, w.mean, welford_ci(&w));
+    store_commit(&store, &sink);
 }
 
-// Function to get current time; similar to rdtscp
-__attribute__((always_inline)) inline uint64_t read_cntvct(void)
+void teardown(void *ctx)
 {
-    uint64_t val;
-    asm volatile("dsb ish" ::: "memory");
-    asm volatile("mrs %0, cntvct_el0" : "=r"(val)); // Barrier before and after reading the counter
-    asm volatile("dsb ish" ::: "memory");
-    return val;
+    timer_close(&timer);
+    perturb_report(&perturb, stdout);
+    perturb_close(&perturb);
+    store_report(&store, stdout);
+    sink_flush(&sink);
 }
 
-uint64_t measure_branch_time(int iterations)
+int main(int argc, char **argv)
 {
-    uint64_t start_time, end_time, total_time = 0;
+    struct sweep sweep;
+    uintptr_t target_address = TARGET_ADDRESS;
+    const char *cpus = NULL;
+    int reserve = 0;
+    long max_trials = TRIALS_MAX;
+    double rel_err = TRIALS_REL_ERR;
+    const char *results_path = NULL, *results_format = NULL;
+    const char *store_dir = NULL;
+    int force = 0;
+    double threshold = 0;
+    int num_index_bits = parse_range(DEFAULT_INDEX_BITS, index_bits, MAX_RANGE_LEN);
+    int cpu = 0;
+    int opt;
 
-    for (int i = 0; i < iterations; i++)
+    while ((opt = getopt(argc, argv, "a:b:c:j:kN:t:n:e:P:o:f:R:FA:")) != -1)
     {
-        start_time = read_cntvct();
-        #pragma GCC unroll 64
-        for (int j = 0; j < MAX_FUNC_PTR_NUM; j++)
-            perform_branch[j]();
-        end_time = read_cntvct();
-        total_time += end_time - start_time;
+        switch (opt)
+        {
+        case 'a':
+            target_address = strtoull(optarg, NULL, 0);
+            break;
+        case 'b':
+            num_index_bits = parse_range(optarg, index_bits, MAX_RANGE_LEN);
+            break;
+        case 'c':
+            cpu = atoi(optarg);
+            break;
+        case 'j':
+            cpus = optarg;
+            break;
+        case 'k':
+            reserve = 1;
+            break;
+        case 'N':
+            copies = atoi(optarg);
+            break;
+        case 't':
+            timer_name = optarg;
+            break;
+        case 'n':
+            max_trials = atol(optarg);
+            break;
+        case 'e':
+            rel_err = atof(optarg);
+            break;
+        case 'P':
+            perturb_mode = optarg;
+            break;
+        case 'o':
+            results_path = optarg;
+            break;
+        case 'f':
+            results_format = optarg;
+            break;
+        case 'R':
+            store_dir = optarg;
+            break;
+        case 'F':
+            force = 1;
+            break;
+        case 'A':
+            threshold = atof(optarg);
+            break;
+        default:
+            fprintf(stderr,
+                    "Usage: %s [-a address] [-b index_bits] [-N copies] [-c cpu | -j cpus|all [-k]] [-t timer] "
+                    "[-n max_trials] [-e rel_err] [-P none|sw|irq|all] [-o results [-f csv|jsonl|bin]] "
+                    "[-R store [-F]] [-A threshold]\n",
+                    argv[0]);
+            return EXIT_FAILURE;
+        }
     }
 
-    return total_time;
-}
+    if (copies < 1 || copies > MAX_FUNC_PTR_NUM)
+    {
+        fprintf(stderr, "Number of copies must be between 1 and %d: %d\n", MAX_FUNC_PTR_NUM, copies);
+        return EXIT_FAILURE;
+    }
 
-int main()
-{
-    uint64_t time_diff;
-    int index_bits = 4;
-    int max_index_bits = 26;
+    // One worker per CPU, pinned; -k leaves the lowest CPU to the OS
+    sweep_parse(&sweep, cpus, reserve, cpu);
+    trials_init(&tc, max_trials, rel_err);
 
-    // Bind the process to CPU 0
-    bind_to_cpu(0);
+    // Map the object once; the function bytes are placed straight from the mapping for every stride
+    struct elf_cache cache;
+    elf_cache_open(&cache, "branch.o");
+    func = elf_cache_get(&cache, "perform_branch");
 
-    for (; index_bits <= max_index_bits; index_bits++)
+    // Reserve one span large enough for the widest stride and keep it for the whole sweep
+    int max_bits = 0;
+    for (int i = 0; i < num_index_bits; i++)
     {
-        // Load the function containing the branch instruction
-        load_function("branch.o", "perform_branch", index_bits);
+        if (index_bits[i] < 0 || index_bits[i] > 40 || func->size > (size_t)1 << index_bits[i])
+        {
+            fprintf(stderr, "Function size %zu does not fit a stride of %d index bits\n", func->size, index_bits[i]);
+            return EXIT_FAILURE;
+        }
+        if (index_bits[i] > max_bits)
+            max_bits = index_bits[i];
+    }
+
+    // Workers inherit the reservation and each fill their own copy-on-write view of it
+    arena_reserve(&arena, target_address, ((size_t)1 << max_bits) * copies);
 
-        // Measure the time taken for branches
-        time_diff = measure_branch_time(TRIALS);
-        printf("Index bits: %d, Average time taken for branch: %f\n", index_bits, 1.0 * time_diff / TRIALS);
+    // One record per sweep point, written by whichever worker measured it
+    sink_open(&sink, results_path, results_format);
+    col_index_bits = sink_column(&sink, "index_bits", SINK_INT);
+    col_cpu = sink_column(&sink, "cpu", SINK_INT);
+    col_trials = sink_column(&sink, "trials", SINK_INT);
+    col_mean = sink_column(&sink, "window_ticks", SINK_FLOAT);
+    col_ci = sink_column(&sink, "window_ci", SINK_FLOAT);
+    col_net = sink_column(&sink, "net_ticks_per_branch", SINK_FLOAT);
+    sink_meta_system(&sink, sweep.cpus[0], argc, argv);
+    sink_meta(&sink, "experiment", "btb_index");
+    if (results_path || store_dir)
+    {
+        // Workers calibrate their own timers; resolve the name here so the record says which one ran
+        struct timer probe;
+        timer_open_named(&probe, timer_name);
+        sink_meta(&sink, "timer", "%s", probe.name);
+        timer_close(&probe);
     }
+    sink_meta(&sink, "copies", "%d", copies);
+    sink_meta(&sink, "address", "%#lx", (unsigned long)target_address);
+    sink_meta(&sink, "max_trials", "%ld", max_trials);
+    sink_meta(&sink, "rel_err", "%g", rel_err);
+    sink_meta(&sink, "perturb", "%s", perturb_mode);
+    sink_start(&sink);
+
+    // Points already in the store are replayed instead of measured, unless -F
+    store_open(&store, store_dir, force, &sink);
+
+    // Coarse pass first, then bisection wherever neighbouring points differ by more than -A
+    refine_init(&refine, threshold);
+    refine_axis(&refine, "index_bits", index_bits, num_index_bits);
+    refine_run(&refine, &sweep, setup, run_point, teardown, NULL);
+    refine_report(&refine, stdout);
+    refine_free(&refine);
+
+    sink_close(&sink);
+
+    arena_release(&arena);
+    elf_cache_close(&cache);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,251 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "bpure.h"
+#include "emit.h"
+#include "layout.h"
+#include "measure.h"
+#include "refine.h"
+#include "sink.h"
+#include "store.h"
+#include "timer.h"
+#include "workers.h"
+
+#define MAX_RANGE_LEN 4096
+#define DEFAULT_ITERATIONS 1000000
+#define DEFAULT_REPEATS 3
+
+typedef void (*loop_fn)(uint64_t iterations);
+
+struct timer timer;
+struct overhead overhead;
+struct emit_buf eb;
+int dists[MAX_RANGE_LEN], branches[MAX_RANGE_LEN];
+int num_branches = 0;
+uint64_t iterations = DEFAULT_ITERATIONS;
+int repeats = DEFAULT_REPEATS;
+const char *timer_name = "auto";
+struct sink sink;
+struct store store;
+struct refine refine;
+int col_dist, col_branches, col_cpu, col_best, col_avg, col_ns_per_branch;
+int worker_cpu;
+
+// One timed call of loop
+uint64_t measure_loop(loop_fn loop, uint64_t iterations)
+{
+    uint64_t start_time = timer_read(&timer);
+    loop(iterations);
+    uint64_t end_time = timer_read(&timer);
+    return end_time - start_time;
+}
+
+uint64_t measure_empty(void *ctx)
+{
+    return measure_loop((loop_fn)empty_gadget(), 1);
+}
+
+void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [-i iterations] [-r repeats] [-c cpu | -j cpus|all [-k]] [-t timer] "
+            "[-o results [-f csv|jsonl|bin]] [-R store [-F]] [-A threshold] -d distances -b branches\n",
+            prog);
+    fprintf(stderr, "  ranges: N, A..B, A..B:step, A..B*factor, or a comma separated list of those\n");
+    exit(EXIT_FAILURE);
+}
+
+// Per worker: everything that depends on the core it runs on
+void setup(int cpu, void *ctx)
+{
+    worker_cpu = cpu;
+
+    // Calibrate the timer on the CPU it will be read on
+    timer_open_named(&timer, timer_name);
+    timer_report(&timer, stdout);
+
+    // Cost of the timed call itself, with an empty gadget in place of the loop
+    overhead_calibrate(&overhead, measure_empty, NULL, OVERHEAD_SAMPLES);
+    overhead_report(&overhead, &timer, stdout);
+}
+
+// One distance x branches cell of the grid, distances major as refine numbers them
+void run_point(int point, void *ctx)
+{
+    int dist = dists[point / num_branches], branch = branches[point % num_branches];
+
+    if (store_lookup(&store, &sink, "distance=%d branches=%d", dist, branch))
+    {
+        refine_record(&refine, point, sink.row[col_ns_per_branch].f, 0);
+        return;
+    }
+
+    loop_fn loop = (loop_fn)layout_loop(&eb, dist, branch);
+    uint64_t best = UINT64_MAX, total = 0;
+
+    loop(iterations); // warm up caches and the predictor
+
+    for (int r = 0; r < repeats; r++)
+    {
+        uint64_t delta = measure_loop(loop, iterations);
+
+        total += delta;
+        if (delta < best)
+            best = delta;
+    }
+
+    double per_branch = overhead_net(&overhead, best) / ((double)iterations * branch);
+    store_printf(&store, "Distance: %d, Branches: %d, Best ticks: %lu, Average ticks: %f, Time per branch: %f ns\n",
+                 dist, branch, best, (double)total / repeats, per_branch * timer.ns_per_tick);
+
+    sink_int(&sink, col_dist, dist);
+    sink_int(&sink, col_branches, branch);
+    sink_int(&sink, col_cpu, worker_cpu);
+    sink_int(&sink, col_best, best);
+    sink_float(&sink, col_avg, (double)total / repeats);
+    sink_float(&sink, col_ns_per_branch, per_branch * timer.ns_per_tick);
+    refine_record(&refine, point, per_branch * timer.ns_per_tick, 0);
+    store_commit(&store, &sink);
+}
+
+void teardown(void *ctx)
+{
+    timer_close(&timer);
+    store_report(&store, stdout);
+    sink_flush(&sink);
+}
+
+int main(int argc, char **argv)
+{
+    struct sweep sweep;
+    const char *cpus = NULL;
+    int reserve = 0;
+    int num_dists = 0;
+    const char *results_path = NULL, *results_format = NULL;
+    const char *store_dir = NULL;
+    int force = 0;
+    double threshold = 0;
+    int cpu = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:r:c:j:kt:d:b:o:f:R:FA:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'i':
+            iterations = strtoull(optarg, NULL, 0);
+            break;
+        case 'r':
+            repeats = atoi(optarg);
+            break;
+        case 'c':
+            cpu = atoi(optarg);
+            break;
+        case 'j':
+            cpus = optarg;
+            break;
+        case 'k':
+            reserve = 1;
+            break;
+        case 't':
+            timer_name = optarg;
+            break;
+        case 'd':
+            num_dists = parse_range(optarg, dists, MAX_RANGE_LEN);
+            break;
+        case 'b':
+            num_branches = parse_range(optarg, branches, MAX_RANGE_LEN);
+            break;
+        case 'o':
+            results_path = optarg;
+            break;
+        case 'f':
+            results_format = optarg;
+            break;
+        case 'R':
+            store_dir = optarg;
+            break;
+        case 'F':
+            force = 1;
+            break;
+        case 'A':
+            threshold = atof(optarg);
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+
+    if (num_dists == 0 || num_branches == 0 || iterations == 0 || repeats < 1)
+        usage(argv[0]);
+
+    // Size the buffer once for the largest layout in the grid
+    int max_dist = 0, max_branches = 0;
+    for (int i = 0; i < num_dists; i++)
+    {
+        if (dists[i] < 12 || dists[i] % 4 != 0)
+        {
+            fprintf(stderr, "Distance must be a multiple of 4 and at least 12: %d\n", dists[i]);
+            return EXIT_FAILURE;
+        }
+        if (dists[i] > max_dist)
+            max_dist = dists[i];
+    }
+    for (int i = 0; i < num_branches; i++)
+    {
+        if (branches[i] < 1)
+        {
+            fprintf(stderr, "Number of branches must be positive: %d\n", branches[i]);
+            return EXIT_FAILURE;
+        }
+        if (branches[i] > max_branches)
+            max_branches = branches[i];
+    }
+
+    // Workers inherit the buffer and rewrite their own private copy of it
+    emit_init(&eb, NULL, (size_t)max_dist * max_branches + 64);
+
+    // One worker per CPU, pinned; -k leaves the lowest CPU to the OS
+    sweep_parse(&sweep, cpus, reserve, cpu);
+
+    // One record per sweep point, written by whichever worker measured it
+    sink_open(&sink, results_path, results_format);
+    col_dist = sink_column(&sink, "distance", SINK_INT);
+    col_branches = sink_column(&sink, "branches", SINK_INT);
+    col_cpu = sink_column(&sink, "cpu", SINK_INT);
+    col_best = sink_column(&sink, "best_ticks", SINK_INT);
+    col_avg = sink_column(&sink, "average_ticks", SINK_FLOAT);
+    col_ns_per_branch = sink_column(&sink, "ns_per_branch", SINK_FLOAT);
+    sink_meta_system(&sink, sweep.cpus[0], argc, argv);
+    sink_meta(&sink, "experiment", "btb_size");
+    if (results_path || store_dir)
+    {
+        // Workers calibrate their own timers; resolve the name here so the record says which one ran
+        struct timer probe;
+        timer_open_named(&probe, timer_name);
+        sink_meta(&sink, "timer", "%s", probe.name);
+        timer_close(&probe);
+    }
+    sink_meta(&sink, "iterations", "%lu", iterations);
+    sink_meta(&sink, "repeats", "%d", repeats);
+    sink_start(&sink);
+
+    // Points already in the store are replayed instead of measured, unless -F
+    store_open(&store, store_dir, force, &sink);
+
+    // Coarse pass first, then bisection wherever neighbouring points differ by more than -A
+    refine_init(&refine, threshold);
+    refine_axis(&refine, "distance", dists, num_dists);
+    refine_axis(&refine, "branches", branches, num_branches);
+    refine_run(&refine, &sweep, setup, run_point, teardown, NULL);
+    refine_report(&refine, stdout);
+    refine_free(&refine);
+
+    sink_close(&sink);
+
+    emit_free(&eb);
+
+    return 0;
+}
@@ -1,33777 +0,0 @@
-#include <stdio.h>
-#include <time.h>
-int main(void) { 
-clock_t start, end;
-start = clock();
-unsigned long i;
-unsigned long liter = 1000000;
-for (i = 0; i < liter; ++i) {
-__asm__ volatile (
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l0\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l0: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l5\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l5: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l6\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l6: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l7\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l7: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l8\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l8: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l9\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l9: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l10\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l10: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l11\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l11: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l12\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l12: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l13\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l13: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l14\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l14: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l15\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l15: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l16\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l16: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l17\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l17: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l18\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l18: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l19\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l19: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l20\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l20: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l21\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l21: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l22\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l22: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l23\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l23: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l24\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l24: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l25\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l25: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l26\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l26: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l27\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l27: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l28\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l28: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l29\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l29: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l30\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l30: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l31\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l31: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l32\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l32: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l33\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l33: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l34\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l34: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l35\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l35: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l36\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l36: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l37\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l37: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l38\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l38: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l39\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l39: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l40\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l40: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l41\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l41: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l42\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l42: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l43\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l43: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l44\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l44: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l45\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l45: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l46\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l46: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l47\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l47: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l48\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l48: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l49\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l49: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l50\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l50: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l51\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l51: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l52\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l52: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l53\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l53: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l54\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l54: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l55\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l55: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l56\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l56: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l57\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l57: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l58\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l58: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l59\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l59: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l60\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l60: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l61\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l61: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l62\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l62: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l63\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l63: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l64\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l64: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l65\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l65: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l66\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l66: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l67\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l67: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l68\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l68: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l69\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l69: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l70\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l70: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l71\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l71: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l72\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l72: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l73\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l73: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l74\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l74: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l75\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l75: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l76\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l76: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l77\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l77: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l78\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l78: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l79\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l79: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l80\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l80: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l81\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l81: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l82\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l82: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l83\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l83: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l84\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l84: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l85\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l85: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l86\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l86: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l87\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l87: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l88\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l88: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l89\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l89: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l90\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l90: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l91\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l91: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l92\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l92: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l93\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l93: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l94\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l94: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l95\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l95: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l96\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l96: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l97\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l97: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l98\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l98: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l99\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l99: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l100\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l100: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l101\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l101: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l102\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l102: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l103\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l103: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l104\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l104: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l105\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l105: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l106\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l106: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l107\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l107: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l108\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l108: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l109\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l109: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l110\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l110: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l111\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l111: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l112\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l112: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l113\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l113: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l114\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l114: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l115\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l115: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l116\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l116: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l117\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l117: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l118\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l118: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l119\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l119: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l120\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l120: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l121\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l121: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l122\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l122: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l123\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l123: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l124\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l124: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l125\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l125: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l126\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l126: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l127\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l127: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l128\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l128: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l129\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l129: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l130\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l130: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l131\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l131: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l132\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l132: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l133\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l133: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l134\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l134: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l135\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l135: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l136\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l136: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l137\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l137: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l138\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l138: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l139\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l139: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l140\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l140: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l141\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l141: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l142\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l142: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l143\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l143: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l144\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l144: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l145\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l145: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l146\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l146: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l147\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l147: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l148\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l148: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l149\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l149: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l150\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l150: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l151\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l151: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l152\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l152: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l153\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l153: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l154\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l154: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l155\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l155: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l156\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l156: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l157\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l157: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l158\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l158: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l159\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l159: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l160\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l160: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l161\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l161: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l162\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l162: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l163\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l163: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l164\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l164: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l165\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l165: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l166\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l166: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l167\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l167: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l168\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l168: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l169\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l169: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l170\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l170: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l171\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l171: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l172\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l172: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l173\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l173: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l174\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l174: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l175\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l175: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l176\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l176: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l177\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l177: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l178\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l178: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l179\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l179: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l180\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l180: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l181\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l181: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l182\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l182: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l183\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l183: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l184\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l184: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l185\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l185: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l186\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l186: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l187\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l187: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l188\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l188: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l189\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l189: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l190\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l190: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l191\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l191: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l192\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l192: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l193\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l193: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l194\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l194: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l195\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l195: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l196\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l196: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l197\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l197: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l198\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l198: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l199\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l199: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l200\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l200: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l201\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l201: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l202\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l202: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l203\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l203: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l204\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l204: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l205\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l205: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l206\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l206: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l207\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l207: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l208\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l208: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l209\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l209: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l210\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l210: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l211\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l211: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l212\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l212: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l213\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l213: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l214\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l214: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l215\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l215: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l216\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l216: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l217\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l217: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l218\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l218: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l219\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l219: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l220\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l220: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l221\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l221: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l222\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l222: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l223\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l223: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l224\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l224: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l225\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l225: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l226\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l226: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l227\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l227: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l228\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l228: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l229\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l229: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l230\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l230: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l231\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l231: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l232\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l232: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l233\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l233: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l234\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l234: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l235\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l235: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l236\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l236: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l237\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l237: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l238\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l238: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l239\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l239: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l240\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l240: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l241\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l241: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l242\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l242: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l243\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l243: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l244\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l244: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l245\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l245: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l246\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l246: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l247\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l247: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l248\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l248: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l249\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l249: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l250\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l250: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l251\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l251: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l252\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l252: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l253\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l253: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l254\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l254: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l255\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l255: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l256\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l256: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l257\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l257: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l258\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l258: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l259\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l259: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l260\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l260: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l261\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l261: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l262\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l262: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l263\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l263: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l264\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l264: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l265\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l265: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l266\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l266: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l267\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l267: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l268\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l268: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l269\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l269: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l270\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l270: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l271\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l271: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l272\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l272: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l273\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l273: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l274\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l274: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l275\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l275: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l276\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l276: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l277\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l277: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l278\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l278: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l279\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l279: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l280\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l280: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l281\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l281: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l282\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l282: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l283\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l283: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l284\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l284: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l285\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l285: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l286\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l286: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l287\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l287: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l288\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l288: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l289\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l289: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l290\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l290: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l291\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l291: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l292\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l292: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l293\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l293: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l294\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l294: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l295\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l295: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l296\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l296: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l297\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l297: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l298\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l298: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l299\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l299: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l300\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l300: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l301\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l301: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l302\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l302: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l303\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l303: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l304\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l304: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l305\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l305: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l306\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l306: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l307\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l307: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l308\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l308: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l309\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l309: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l310\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l310: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l311\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l311: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l312\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l312: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l313\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l313: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l314\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l314: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l315\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l315: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l316\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l316: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l317\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l317: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l318\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l318: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l319\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l319: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l320\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l320: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l321\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l321: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l322\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l322: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l323\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l323: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l324\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l324: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l325\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l325: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l326\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l326: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l327\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l327: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l328\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l328: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l329\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l329: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l330\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l330: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l331\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l331: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l332\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l332: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l333\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l333: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l334\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l334: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l335\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l335: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l336\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l336: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l337\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l337: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l338\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l338: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l339\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l339: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l340\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l340: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l341\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l341: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l342\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l342: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l343\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l343: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l344\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l344: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l345\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l345: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l346\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l346: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l347\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l347: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l348\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l348: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l349\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l349: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l350\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l350: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l351\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l351: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l352\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l352: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l353\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l353: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l354\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l354: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l355\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l355: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l356\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l356: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l357\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l357: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l358\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l358: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l359\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l359: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l360\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l360: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l361\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l361: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l362\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l362: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l363\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l363: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l364\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l364: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l365\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l365: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l366\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l366: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l367\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l367: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l368\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l368: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l369\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l369: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l370\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l370: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l371\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l371: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l372\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l372: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l373\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l373: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l374\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l374: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l375\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l375: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l376\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l376: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l377\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l377: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l378\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l378: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l379\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l379: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l380\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l380: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l381\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l381: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l382\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l382: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l383\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l383: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l384\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l384: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l385\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l385: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l386\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l386: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l387\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l387: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l388\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l388: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l389\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l389: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l390\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l390: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l391\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l391: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l392\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l392: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l393\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l393: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l394\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l394: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l395\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l395: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l396\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l396: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l397\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l397: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l398\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l398: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l399\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l399: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l400\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l400: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l401\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l401: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l402\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l402: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l403\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l403: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l404\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l404: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l405\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l405: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l406\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l406: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l407\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l407: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l408\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l408: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l409\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l409: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l410\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l410: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l411\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l411: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l412\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l412: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l413\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l413: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l414\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l414: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l415\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l415: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l416\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l416: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l417\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l417: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l418\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l418: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l419\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l419: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l420\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l420: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l421\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l421: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l422\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l422: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l423\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l423: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l424\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l424: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l425\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l425: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l426\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l426: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l427\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l427: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l428\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l428: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l429\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l429: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l430\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l430: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l431\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l431: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l432\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l432: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l433\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l433: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l434\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l434: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l435\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l435: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l436\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l436: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l437\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l437: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l438\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l438: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l439\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l439: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l440\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l440: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l441\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l441: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l442\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l442: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l443\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l443: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l444\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l444: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l445\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l445: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l446\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l446: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l447\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l447: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l448\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l448: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l449\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l449: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l450\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l450: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l451\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l451: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l452\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l452: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l453\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l453: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l454\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l454: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l455\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l455: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l456\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l456: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l457\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l457: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l458\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l458: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l459\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l459: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l460\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l460: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l461\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l461: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l462\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l462: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l463\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l463: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l464\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l464: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l465\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l465: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l466\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l466: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l467\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l467: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l468\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l468: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l469\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l469: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l470\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l470: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l471\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l471: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l472\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l472: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l473\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l473: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l474\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l474: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l475\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l475: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l476\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l476: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l477\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l477: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l478\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l478: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l479\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l479: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l480\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l480: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l481\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l481: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l482\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l482: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l483\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l483: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l484\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l484: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l485\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l485: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l486\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l486: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l487\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l487: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l488\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l488: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l489\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l489: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l490\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l490: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l491\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l491: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l492\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l492: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l493\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l493: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l494\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l494: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l495\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l495: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l496\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l496: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l497\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l497: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l498\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l498: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l499\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l499: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l500\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l500: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l501\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l501: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l502\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l502: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l503\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l503: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l504\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l504: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l505\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l505: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l506\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l506: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l507\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l507: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l508\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l508: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l509\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l509: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l510\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l510: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l511\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l511: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l512\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l512: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l513\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l513: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l514\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l514: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l515\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l515: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l516\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l516: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l517\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l517: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l518\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l518: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l519\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l519: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l520\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l520: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l521\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l521: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l522\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l522: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l523\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l523: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l524\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l524: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l525\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l525: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l526\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l526: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l527\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l527: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l528\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l528: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l529\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l529: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l530\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l530: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l531\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l531: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l532\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l532: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l533\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l533: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l534\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l534: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l535\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l535: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l536\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l536: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l537\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l537: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l538\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l538: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l539\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l539: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l540\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l540: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l541\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l541: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l542\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l542: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l543\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l543: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l544\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l544: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l545\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l545: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l546\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l546: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l547\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l547: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l548\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l548: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l549\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l549: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l550\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l550: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l551\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l551: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l552\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l552: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l553\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l553: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l554\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l554: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l555\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l555: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l556\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l556: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l557\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l557: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l558\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l558: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l559\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l559: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l560\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l560: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l561\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l561: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l562\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l562: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l563\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l563: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l564\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l564: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l565\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l565: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l566\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l566: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l567\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l567: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l568\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l568: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l569\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l569: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l570\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l570: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l571\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l571: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l572\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l572: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l573\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l573: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l574\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l574: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l575\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l575: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l576\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l576: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l577\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l577: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l578\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l578: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l579\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l579: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l580\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l580: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l581\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l581: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l582\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l582: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l583\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l583: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l584\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l584: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l585\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l585: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l586\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l586: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l587\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l587: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l588\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l588: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l589\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l589: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l590\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l590: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l591\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l591: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l592\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l592: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l593\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l593: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l594\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l594: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l595\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l595: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l596\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l596: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l597\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l597: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l598\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l598: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l599\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l599: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l600\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l600: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l601\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l601: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l602\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l602: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l603\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l603: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l604\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l604: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l605\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l605: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l606\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l606: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l607\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l607: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l608\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l608: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l609\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l609: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l610\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l610: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l611\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l611: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l612\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l612: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l613\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l613: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l614\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l614: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l615\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l615: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l616\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l616: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l617\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l617: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l618\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l618: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l619\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l619: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l620\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l620: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l621\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l621: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l622\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l622: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l623\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l623: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l624\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l624: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l625\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l625: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l626\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l626: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l627\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l627: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l628\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l628: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l629\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l629: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l630\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l630: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l631\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l631: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l632\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l632: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l633\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l633: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l634\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l634: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l635\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l635: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l636\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l636: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l637\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l637: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l638\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l638: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l639\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l639: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l640\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l640: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l641\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l641: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l642\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l642: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l643\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l643: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l644\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l644: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l645\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l645: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l646\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l646: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l647\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l647: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l648\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l648: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l649\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l649: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l650\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l650: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l651\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l651: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l652\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l652: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l653\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l653: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l654\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l654: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l655\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l655: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l656\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l656: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l657\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l657: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l658\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l658: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l659\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l659: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l660\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l660: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l661\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l661: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l662\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l662: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l663\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l663: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l664\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l664: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l665\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l665: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l666\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l666: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l667\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l667: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l668\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l668: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l669\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l669: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l670\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l670: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l671\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l671: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l672\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l672: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l673\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l673: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l674\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l674: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l675\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l675: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l676\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l676: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l677\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l677: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l678\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l678: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l679\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l679: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l680\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l680: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l681\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l681: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l682\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l682: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l683\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l683: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l684\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l684: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l685\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l685: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l686\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l686: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l687\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l687: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l688\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l688: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l689\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l689: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l690\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l690: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l691\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l691: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l692\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l692: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l693\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l693: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l694\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l694: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l695\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l695: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l696\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l696: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l697\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l697: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l698\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l698: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l699\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l699: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l700\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l700: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l701\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l701: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l702\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l702: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l703\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l703: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l704\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l704: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l705\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l705: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l706\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l706: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l707\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l707: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l708\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l708: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l709\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l709: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l710\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l710: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l711\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l711: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l712\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l712: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l713\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l713: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l714\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l714: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l715\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l715: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l716\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l716: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l717\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l717: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l718\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l718: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l719\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l719: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l720\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l720: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l721\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l721: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l722\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l722: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l723\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l723: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l724\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l724: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l725\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l725: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l726\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l726: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l727\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l727: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l728\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l728: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l729\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l729: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l730\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l730: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l731\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l731: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l732\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l732: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l733\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l733: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l734\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l734: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l735\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l735: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l736\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l736: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l737\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l737: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l738\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l738: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l739\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l739: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l740\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l740: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l741\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l741: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l742\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l742: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l743\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l743: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l744\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l744: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l745\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l745: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l746\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l746: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l747\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l747: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l748\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l748: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l749\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l749: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l750\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l750: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l751\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l751: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l752\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l752: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l753\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l753: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l754\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l754: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l755\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l755: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l756\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l756: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l757\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l757: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l758\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l758: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l759\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l759: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l760\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l760: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l761\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l761: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l762\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l762: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l763\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l763: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l764\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l764: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l765\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l765: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l766\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l766: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l767\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l767: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l768\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l768: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l769\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l769: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l770\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l770: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l771\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l771: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l772\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l772: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l773\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l773: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l774\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l774: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l775\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l775: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l776\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l776: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l777\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l777: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l778\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l778: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l779\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l779: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l780\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l780: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l781\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l781: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l782\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l782: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l783\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l783: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l784\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l784: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l785\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l785: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l786\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l786: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l787\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l787: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l788\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l788: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l789\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l789: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l790\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l790: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l791\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l791: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l792\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l792: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l793\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l793: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l794\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l794: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l795\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l795: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l796\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l796: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l797\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l797: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l798\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l798: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l799\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l799: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l800\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l800: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l801\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l801: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l802\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l802: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l803\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l803: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l804\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l804: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l805\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l805: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l806\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l806: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l807\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l807: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l808\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l808: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l809\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l809: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l810\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l810: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l811\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l811: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l812\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l812: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l813\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l813: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l814\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l814: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l815\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l815: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l816\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l816: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l817\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l817: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l818\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l818: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l819\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l819: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l820\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l820: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l821\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l821: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l822\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l822: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l823\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l823: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l824\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l824: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l825\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l825: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l826\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l826: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l827\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l827: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l828\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l828: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l829\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l829: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l830\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l830: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l831\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l831: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l832\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l832: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l833\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l833: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l834\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l834: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l835\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l835: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l836\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l836: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l837\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l837: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l838\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l838: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l839\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l839: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l840\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l840: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l841\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l841: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l842\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l842: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l843\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l843: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l844\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l844: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l845\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l845: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l846\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l846: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l847\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l847: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l848\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l848: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l849\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l849: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l850\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l850: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l851\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l851: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l852\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l852: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l853\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l853: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l854\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l854: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l855\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l855: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l856\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l856: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l857\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l857: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l858\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l858: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l859\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l859: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l860\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l860: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l861\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l861: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l862\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l862: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l863\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l863: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l864\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l864: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l865\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l865: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l866\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l866: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l867\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l867: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l868\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l868: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l869\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l869: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l870\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l870: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l871\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l871: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l872\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l872: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l873\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l873: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l874\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l874: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l875\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l875: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l876\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l876: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l877\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l877: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l878\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l878: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l879\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l879: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l880\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l880: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l881\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l881: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l882\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l882: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l883\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l883: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l884\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l884: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l885\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l885: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l886\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l886: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l887\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l887: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l888\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l888: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l889\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l889: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l890\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l890: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l891\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l891: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l892\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l892: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l893\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l893: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l894\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l894: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l895\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l895: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l896\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l896: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l897\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l897: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l898\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l898: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l899\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l899: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l900\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l900: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l901\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l901: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l902\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l902: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l903\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l903: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l904\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l904: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l905\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l905: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l906\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l906: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l907\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l907: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l908\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l908: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l909\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l909: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l910\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l910: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l911\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l911: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l912\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l912: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l913\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l913: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l914\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l914: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l915\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l915: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l916\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l916: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l917\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l917: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l918\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l918: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l919\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l919: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l920\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l920: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l921\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l921: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l922\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l922: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l923\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l923: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l924\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l924: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l925\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l925: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l926\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l926: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l927\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l927: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l928\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l928: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l929\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l929: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l930\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l930: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l931\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l931: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l932\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l932: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l933\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l933: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l934\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l934: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l935\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l935: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l936\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l936: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l937\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l937: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l938\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l938: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l939\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l939: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l940\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l940: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l941\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l941: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l942\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l942: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l943\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l943: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l944\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l944: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l945\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l945: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l946\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l946: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l947\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l947: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l948\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l948: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l949\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l949: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l950\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l950: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l951\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l951: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l952\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l952: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l953\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l953: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l954\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l954: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l955\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l955: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l956\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l956: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l957\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l957: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l958\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l958: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l959\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l959: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l960\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l960: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l961\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l961: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l962\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l962: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l963\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l963: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l964\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l964: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l965\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l965: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l966\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l966: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l967\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l967: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l968\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l968: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l969\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l969: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l970\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l970: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l971\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l971: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l972\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l972: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l973\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l973: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l974\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l974: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l975\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l975: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l976\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l976: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l977\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l977: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l978\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l978: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l979\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l979: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l980\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l980: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l981\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l981: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l982\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l982: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l983\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l983: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l984\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l984: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l985\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l985: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l986\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l986: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l987\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l987: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l988\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l988: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l989\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l989: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l990\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l990: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l991\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l991: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l992\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l992: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l993\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l993: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l994\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l994: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l995\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l995: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l996\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l996: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l997\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l997: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l998\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l998: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l999\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l999: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1000\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1000: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1001\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1001: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1002\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1002: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1003\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1003: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1004\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1004: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1005\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1005: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1006\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1006: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1007\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1007: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1008\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1008: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1009\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1009: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1010\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1010: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1011\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1011: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1012\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1012: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1013\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1013: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1014\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1014: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1015\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1015: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1016\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1016: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1017\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1017: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1018\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1018: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1019\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1019: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1020\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1020: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1021\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1021: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1022\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1022: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"nop\n\t"
-);
-}
-end = clock();
-printf("CPU time used: %ld\n", end - start);
-return 0;
-}
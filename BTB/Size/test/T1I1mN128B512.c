@@ -1,16881 +0,0 @@
-#include <stdio.h>
-#include <time.h>
-int main(void) { 
-clock_t start, end;
-start = clock();
-unsigned long i;
-unsigned long liter = 1000000;
-for (i = 0; i < liter; ++i) {
-__asm__ volatile (
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l0\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l0: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l5\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l5: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l6\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l6: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l7\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l7: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l8\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l8: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l9\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l9: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l10\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l10: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l11\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l11: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l12\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l12: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l13\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l13: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l14\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l14: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l15\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l15: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l16\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l16: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l17\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l17: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l18\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l18: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l19\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l19: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l20\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l20: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l21\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l21: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l22\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l22: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l23\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l23: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l24\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l24: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l25\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l25: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l26\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l26: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l27\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l27: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l28\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l28: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l29\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l29: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l30\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l30: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l31\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l31: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l32\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l32: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l33\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l33: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l34\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l34: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l35\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l35: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l36\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l36: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l37\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l37: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l38\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l38: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l39\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l39: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l40\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l40: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l41\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l41: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l42\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l42: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l43\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l43: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l44\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l44: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l45\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l45: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l46\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l46: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l47\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l47: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l48\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l48: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l49\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l49: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l50\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l50: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l51\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l51: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l52\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l52: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l53\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l53: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l54\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l54: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l55\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l55: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l56\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l56: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l57\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l57: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l58\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l58: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l59\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l59: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l60\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l60: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l61\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l61: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l62\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l62: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l63\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l63: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l64\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l64: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l65\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l65: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l66\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l66: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l67\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l67: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l68\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l68: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l69\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l69: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l70\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l70: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l71\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l71: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l72\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l72: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l73\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l73: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l74\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l74: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l75\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l75: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l76\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l76: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l77\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l77: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l78\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l78: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l79\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l79: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l80\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l80: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l81\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l81: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l82\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l82: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l83\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l83: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l84\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l84: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l85\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l85: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l86\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l86: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l87\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l87: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l88\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l88: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l89\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l89: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l90\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l90: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l91\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l91: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l92\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l92: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l93\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l93: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l94\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l94: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l95\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l95: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l96\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l96: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l97\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l97: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l98\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l98: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l99\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l99: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l100\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l100: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l101\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l101: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l102\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l102: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l103\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l103: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l104\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l104: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l105\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l105: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l106\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l106: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l107\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l107: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l108\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l108: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l109\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l109: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l110\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l110: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l111\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l111: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l112\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l112: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l113\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l113: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l114\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l114: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l115\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l115: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l116\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l116: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l117\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l117: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l118\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l118: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l119\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l119: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l120\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l120: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l121\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l121: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l122\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l122: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l123\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l123: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l124\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l124: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l125\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l125: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l126\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l126: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l127\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l127: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l128\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l128: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l129\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l129: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l130\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l130: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l131\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l131: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l132\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l132: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l133\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l133: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l134\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l134: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l135\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l135: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l136\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l136: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l137\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l137: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l138\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l138: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l139\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l139: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l140\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l140: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l141\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l141: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l142\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l142: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l143\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l143: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l144\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l144: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l145\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l145: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l146\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l146: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l147\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l147: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l148\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l148: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l149\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l149: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l150\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l150: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l151\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l151: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l152\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l152: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l153\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l153: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l154\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l154: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l155\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l155: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l156\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l156: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l157\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l157: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l158\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l158: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l159\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l159: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l160\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l160: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l161\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l161: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l162\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l162: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l163\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l163: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l164\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l164: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l165\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l165: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l166\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l166: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l167\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l167: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l168\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l168: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l169\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l169: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l170\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l170: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l171\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l171: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l172\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l172: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l173\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l173: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l174\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l174: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l175\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l175: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l176\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l176: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l177\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l177: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l178\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l178: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l179\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l179: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l180\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l180: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l181\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l181: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l182\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l182: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l183\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l183: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l184\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l184: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l185\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l185: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l186\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l186: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l187\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l187: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l188\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l188: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l189\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l189: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l190\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l190: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l191\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l191: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l192\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l192: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l193\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l193: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l194\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l194: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l195\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l195: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l196\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l196: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l197\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l197: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l198\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l198: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l199\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l199: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l200\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l200: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l201\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l201: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l202\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l202: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l203\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l203: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l204\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l204: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l205\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l205: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l206\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l206: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l207\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l207: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l208\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l208: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l209\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l209: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l210\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l210: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l211\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l211: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l212\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l212: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l213\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l213: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l214\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l214: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l215\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l215: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l216\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l216: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l217\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l217: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l218\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l218: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l219\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l219: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l220\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l220: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l221\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l221: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l222\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l222: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l223\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l223: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l224\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l224: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l225\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l225: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l226\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l226: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l227\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l227: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l228\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l228: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l229\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l229: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l230\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l230: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l231\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l231: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l232\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l232: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l233\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l233: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l234\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l234: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l235\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l235: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l236\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l236: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l237\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l237: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l238\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l238: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l239\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l239: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l240\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l240: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l241\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l241: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l242\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l242: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l243\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l243: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l244\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l244: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l245\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l245: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l246\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l246: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l247\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l247: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l248\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l248: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l249\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l249: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l250\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l250: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l251\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l251: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l252\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l252: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l253\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l253: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l254\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l254: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l255\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l255: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l256\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l256: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l257\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l257: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l258\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l258: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l259\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l259: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l260\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l260: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l261\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l261: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l262\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l262: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l263\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l263: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l264\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l264: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l265\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l265: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l266\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l266: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l267\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l267: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l268\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l268: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l269\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l269: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l270\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l270: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l271\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l271: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l272\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l272: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l273\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l273: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l274\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l274: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l275\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l275: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l276\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l276: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l277\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l277: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l278\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l278: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l279\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l279: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l280\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l280: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l281\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l281: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l282\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l282: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l283\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l283: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l284\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l284: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l285\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l285: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l286\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l286: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l287\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l287: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l288\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l288: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l289\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l289: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l290\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l290: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l291\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l291: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l292\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l292: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l293\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l293: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l294\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l294: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l295\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l295: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l296\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l296: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l297\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l297: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l298\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l298: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l299\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l299: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l300\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l300: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l301\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l301: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l302\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l302: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l303\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l303: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l304\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l304: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l305\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l305: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l306\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l306: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l307\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l307: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l308\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l308: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l309\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l309: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l310\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l310: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l311\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l311: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l312\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l312: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l313\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l313: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l314\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l314: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l315\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l315: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l316\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l316: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l317\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l317: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l318\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l318: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l319\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l319: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l320\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l320: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l321\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l321: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l322\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l322: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l323\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l323: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l324\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l324: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l325\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l325: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l326\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l326: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l327\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l327: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l328\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l328: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l329\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l329: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l330\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l330: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l331\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l331: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l332\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l332: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l333\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l333: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l334\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l334: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l335\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l335: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l336\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l336: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l337\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l337: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l338\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l338: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l339\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l339: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l340\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l340: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l341\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l341: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l342\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l342: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l343\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l343: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l344\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l344: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l345\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l345: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l346\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l346: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l347\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l347: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l348\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l348: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l349\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l349: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l350\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l350: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l351\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l351: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l352\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l352: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l353\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l353: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l354\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l354: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l355\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l355: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l356\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l356: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l357\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l357: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l358\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l358: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l359\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l359: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l360\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l360: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l361\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l361: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l362\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l362: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l363\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l363: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l364\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l364: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l365\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l365: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l366\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l366: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l367\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l367: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l368\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l368: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l369\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l369: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l370\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l370: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l371\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l371: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l372\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l372: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l373\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l373: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l374\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l374: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l375\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l375: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l376\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l376: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l377\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l377: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l378\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l378: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l379\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l379: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l380\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l380: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l381\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l381: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l382\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l382: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l383\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l383: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l384\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l384: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l385\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l385: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l386\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l386: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l387\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l387: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l388\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l388: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l389\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l389: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l390\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l390: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l391\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l391: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l392\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l392: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l393\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l393: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l394\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l394: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l395\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l395: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l396\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l396: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l397\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l397: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l398\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l398: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l399\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l399: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l400\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l400: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l401\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l401: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l402\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l402: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l403\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l403: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l404\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l404: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l405\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l405: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l406\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l406: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l407\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l407: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l408\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l408: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l409\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l409: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l410\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l410: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l411\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l411: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l412\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l412: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l413\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l413: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l414\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l414: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l415\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l415: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l416\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l416: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l417\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l417: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l418\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l418: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l419\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l419: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l420\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l420: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l421\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l421: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l422\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l422: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l423\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l423: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l424\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l424: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l425\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l425: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l426\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l426: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l427\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l427: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l428\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l428: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l429\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l429: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l430\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l430: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l431\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l431: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l432\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l432: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l433\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l433: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l434\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l434: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l435\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l435: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l436\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l436: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l437\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l437: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l438\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l438: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l439\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l439: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l440\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l440: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l441\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l441: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l442\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l442: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l443\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l443: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l444\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l444: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l445\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l445: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l446\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l446: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l447\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l447: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l448\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l448: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l449\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l449: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l450\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l450: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l451\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l451: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l452\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l452: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l453\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l453: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l454\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l454: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l455\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l455: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l456\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l456: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l457\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l457: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l458\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l458: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l459\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l459: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l460\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l460: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l461\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l461: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l462\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l462: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l463\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l463: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l464\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l464: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l465\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l465: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l466\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l466: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l467\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l467: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l468\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l468: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l469\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l469: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l470\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l470: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l471\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l471: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l472\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l472: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l473\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l473: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l474\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l474: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l475\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l475: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l476\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l476: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l477\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l477: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l478\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l478: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l479\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l479: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l480\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l480: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l481\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l481: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l482\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l482: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l483\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l483: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l484\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l484: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l485\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l485: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l486\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l486: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l487\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l487: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l488\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l488: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l489\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l489: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l490\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l490: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l491\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l491: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l492\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l492: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l493\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l493: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l494\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l494: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l495\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l495: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l496\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l496: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l497\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l497: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l498\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l498: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l499\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l499: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l500\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l500: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l501\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l501: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l502\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l502: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l503\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l503: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l504\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l504: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l505\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l505: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l506\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l506: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l507\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l507: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l508\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l508: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l509\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l509: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l510\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l510: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"nop\n\t"
-);
-}
-end = clock();
-printf("CPU time used: %ld\n", end - start);
-return 0;
-}
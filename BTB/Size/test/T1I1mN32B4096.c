@@ -1,36873 +0,0 @@
-#include <stdio.h>
-#include <time.h>
-int main(void) { 
-clock_t start, end;
-start = clock();
-unsigned long i;
-unsigned long liter = 1000000;
-for (i = 0; i < liter; ++i) {
-__asm__ volatile (
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l0\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l0: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l5\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l5: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l6\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l6: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l7\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l7: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l8\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l8: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l9\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l9: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l10\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l10: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l11\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l11: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l12\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l12: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l13\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l13: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l14\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l14: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l15\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l15: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l16\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l16: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l17\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l17: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l18\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l18: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l19\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l19: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l20\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l20: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l21\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l21: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l22\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l22: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l23\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l23: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l24\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l24: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l25\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l25: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l26\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l26: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l27\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l27: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l28\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l28: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l29\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l29: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l30\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l30: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l31\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l31: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l32\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l32: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l33\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l33: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l34\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l34: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l35\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l35: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l36\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l36: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l37\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l37: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l38\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l38: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l39\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l39: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l40\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l40: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l41\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l41: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l42\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l42: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l43\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l43: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l44\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l44: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l45\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l45: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l46\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l46: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l47\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l47: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l48\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l48: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l49\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l49: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l50\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l50: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l51\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l51: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l52\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l52: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l53\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l53: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l54\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l54: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l55\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l55: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l56\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l56: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l57\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l57: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l58\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l58: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l59\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l59: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l60\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l60: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l61\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l61: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l62\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l62: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l63\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l63: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l64\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l64: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l65\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l65: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l66\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l66: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l67\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l67: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l68\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l68: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l69\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l69: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l70\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l70: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l71\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l71: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l72\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l72: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l73\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l73: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l74\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l74: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l75\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l75: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l76\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l76: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l77\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l77: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l78\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l78: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l79\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l79: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l80\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l80: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l81\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l81: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l82\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l82: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l83\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l83: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l84\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l84: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l85\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l85: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l86\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l86: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l87\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l87: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l88\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l88: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l89\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l89: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l90\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l90: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l91\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l91: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l92\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l92: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l93\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l93: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l94\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l94: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l95\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l95: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l96\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l96: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l97\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l97: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l98\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l98: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l99\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l99: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l100\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l100: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l101\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l101: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l102\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l102: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l103\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l103: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l104\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l104: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l105\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l105: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l106\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l106: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l107\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l107: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l108\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l108: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l109\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l109: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l110\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l110: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l111\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l111: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l112\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l112: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l113\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l113: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l114\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l114: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l115\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l115: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l116\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l116: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l117\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l117: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l118\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l118: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l119\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l119: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l120\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l120: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l121\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l121: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l122\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l122: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l123\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l123: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l124\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l124: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l125\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l125: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l126\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l126: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l127\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l127: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l128\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l128: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l129\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l129: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l130\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l130: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l131\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l131: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l132\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l132: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l133\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l133: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l134\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l134: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l135\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l135: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l136\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l136: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l137\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l137: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l138\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l138: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l139\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l139: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l140\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l140: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l141\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l141: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l142\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l142: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l143\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l143: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l144\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l144: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l145\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l145: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l146\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l146: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l147\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l147: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l148\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l148: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l149\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l149: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l150\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l150: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l151\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l151: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l152\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l152: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l153\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l153: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l154\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l154: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l155\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l155: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l156\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l156: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l157\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l157: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l158\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l158: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l159\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l159: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l160\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l160: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l161\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l161: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l162\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l162: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l163\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l163: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l164\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l164: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l165\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l165: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l166\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l166: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l167\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l167: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l168\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l168: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l169\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l169: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l170\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l170: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l171\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l171: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l172\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l172: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l173\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l173: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l174\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l174: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l175\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l175: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l176\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l176: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l177\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l177: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l178\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l178: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l179\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l179: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l180\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l180: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l181\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l181: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l182\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l182: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l183\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l183: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l184\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l184: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l185\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l185: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l186\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l186: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l187\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l187: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l188\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l188: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l189\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l189: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l190\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l190: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l191\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l191: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l192\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l192: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l193\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l193: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l194\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l194: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l195\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l195: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l196\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l196: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l197\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l197: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l198\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l198: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l199\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l199: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l200\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l200: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l201\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l201: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l202\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l202: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l203\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l203: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l204\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l204: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l205\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l205: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l206\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l206: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l207\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l207: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l208\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l208: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l209\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l209: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l210\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l210: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l211\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l211: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l212\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l212: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l213\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l213: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l214\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l214: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l215\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l215: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l216\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l216: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l217\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l217: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l218\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l218: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l219\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l219: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l220\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l220: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l221\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l221: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l222\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l222: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l223\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l223: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l224\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l224: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l225\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l225: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l226\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l226: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l227\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l227: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l228\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l228: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l229\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l229: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l230\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l230: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l231\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l231: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l232\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l232: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l233\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l233: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l234\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l234: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l235\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l235: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l236\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l236: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l237\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l237: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l238\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l238: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l239\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l239: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l240\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l240: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l241\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l241: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l242\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l242: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l243\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l243: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l244\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l244: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l245\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l245: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l246\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l246: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l247\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l247: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l248\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l248: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l249\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l249: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l250\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l250: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l251\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l251: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l252\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l252: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l253\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l253: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l254\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l254: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l255\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l255: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l256\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l256: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l257\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l257: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l258\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l258: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l259\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l259: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l260\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l260: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l261\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l261: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l262\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l262: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l263\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l263: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l264\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l264: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l265\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l265: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l266\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l266: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l267\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l267: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l268\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l268: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l269\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l269: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l270\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l270: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l271\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l271: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l272\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l272: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l273\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l273: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l274\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l274: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l275\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l275: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l276\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l276: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l277\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l277: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l278\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l278: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l279\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l279: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l280\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l280: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l281\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l281: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l282\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l282: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l283\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l283: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l284\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l284: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l285\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l285: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l286\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l286: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l287\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l287: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l288\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l288: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l289\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l289: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l290\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l290: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l291\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l291: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l292\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l292: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l293\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l293: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l294\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l294: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l295\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l295: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l296\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l296: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l297\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l297: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l298\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l298: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l299\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l299: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l300\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l300: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l301\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l301: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l302\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l302: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l303\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l303: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l304\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l304: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l305\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l305: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l306\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l306: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l307\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l307: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l308\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l308: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l309\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l309: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l310\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l310: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l311\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l311: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l312\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l312: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l313\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l313: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l314\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l314: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l315\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l315: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l316\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l316: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l317\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l317: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l318\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l318: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l319\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l319: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l320\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l320: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l321\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l321: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l322\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l322: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l323\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l323: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l324\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l324: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l325\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l325: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l326\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l326: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l327\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l327: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l328\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l328: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l329\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l329: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l330\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l330: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l331\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l331: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l332\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l332: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l333\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l333: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l334\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l334: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l335\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l335: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l336\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l336: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l337\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l337: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l338\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l338: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l339\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l339: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l340\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l340: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l341\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l341: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l342\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l342: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l343\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l343: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l344\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l344: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l345\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l345: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l346\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l346: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l347\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l347: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l348\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l348: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l349\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l349: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l350\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l350: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l351\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l351: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l352\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l352: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l353\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l353: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l354\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l354: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l355\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l355: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l356\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l356: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l357\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l357: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l358\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l358: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l359\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l359: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l360\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l360: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l361\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l361: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l362\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l362: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l363\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l363: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l364\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l364: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l365\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l365: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l366\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l366: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l367\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l367: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l368\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l368: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l369\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l369: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l370\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l370: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l371\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l371: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l372\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l372: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l373\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l373: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l374\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l374: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l375\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l375: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l376\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l376: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l377\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l377: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l378\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l378: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l379\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l379: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l380\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l380: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l381\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l381: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l382\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l382: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l383\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l383: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l384\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l384: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l385\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l385: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l386\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l386: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l387\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l387: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l388\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l388: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l389\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l389: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l390\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l390: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l391\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l391: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l392\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l392: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l393\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l393: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l394\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l394: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l395\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l395: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l396\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l396: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l397\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l397: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l398\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l398: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l399\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l399: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l400\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l400: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l401\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l401: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l402\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l402: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l403\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l403: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l404\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l404: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l405\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l405: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l406\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l406: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l407\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l407: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l408\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l408: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l409\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l409: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l410\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l410: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l411\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l411: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l412\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l412: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l413\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l413: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l414\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l414: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l415\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l415: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l416\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l416: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l417\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l417: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l418\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l418: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l419\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l419: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l420\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l420: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l421\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l421: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l422\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l422: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l423\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l423: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l424\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l424: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l425\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l425: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l426\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l426: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l427\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l427: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l428\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l428: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l429\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l429: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l430\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l430: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l431\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l431: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l432\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l432: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l433\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l433: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l434\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l434: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l435\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l435: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l436\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l436: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l437\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l437: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l438\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l438: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l439\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l439: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l440\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l440: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l441\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l441: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l442\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l442: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l443\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l443: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l444\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l444: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l445\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l445: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l446\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l446: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l447\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l447: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l448\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l448: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l449\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l449: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l450\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l450: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l451\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l451: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l452\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l452: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l453\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l453: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l454\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l454: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l455\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l455: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l456\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l456: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l457\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l457: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l458\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l458: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l459\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l459: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l460\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l460: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l461\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l461: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l462\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l462: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l463\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l463: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l464\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l464: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l465\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l465: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l466\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l466: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l467\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l467: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l468\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l468: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l469\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l469: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l470\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l470: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l471\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l471: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l472\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l472: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l473\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l473: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l474\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l474: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l475\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l475: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l476\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l476: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l477\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l477: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l478\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l478: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l479\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l479: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l480\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l480: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l481\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l481: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l482\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l482: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l483\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l483: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l484\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l484: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l485\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l485: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l486\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l486: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l487\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l487: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l488\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l488: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l489\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l489: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l490\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l490: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l491\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l491: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l492\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l492: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l493\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l493: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l494\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l494: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l495\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l495: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l496\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l496: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l497\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l497: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l498\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l498: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l499\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l499: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l500\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l500: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l501\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l501: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l502\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l502: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l503\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l503: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l504\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l504: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l505\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l505: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l506\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l506: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l507\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l507: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l508\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l508: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l509\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l509: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l510\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l510: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l511\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l511: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l512\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l512: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l513\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l513: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l514\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l514: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l515\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l515: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l516\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l516: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l517\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l517: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l518\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l518: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l519\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l519: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l520\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l520: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l521\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l521: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l522\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l522: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l523\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l523: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l524\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l524: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l525\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l525: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l526\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l526: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l527\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l527: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l528\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l528: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l529\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l529: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l530\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l530: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l531\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l531: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l532\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l532: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l533\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l533: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l534\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l534: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l535\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l535: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l536\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l536: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l537\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l537: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l538\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l538: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l539\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l539: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l540\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l540: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l541\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l541: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l542\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l542: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l543\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l543: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l544\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l544: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l545\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l545: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l546\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l546: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l547\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l547: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l548\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l548: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l549\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l549: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l550\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l550: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l551\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l551: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l552\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l552: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l553\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l553: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l554\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l554: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l555\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l555: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l556\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l556: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l557\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l557: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l558\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l558: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l559\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l559: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l560\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l560: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l561\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l561: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l562\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l562: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l563\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l563: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l564\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l564: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l565\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l565: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l566\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l566: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l567\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l567: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l568\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l568: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l569\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l569: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l570\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l570: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l571\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l571: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l572\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l572: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l573\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l573: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l574\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l574: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l575\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l575: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l576\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l576: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l577\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l577: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l578\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l578: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l579\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l579: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l580\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l580: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l581\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l581: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l582\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l582: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l583\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l583: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l584\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l584: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l585\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l585: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l586\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l586: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l587\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l587: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l588\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l588: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l589\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l589: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l590\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l590: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l591\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l591: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l592\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l592: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l593\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l593: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l594\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l594: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l595\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l595: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l596\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l596: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l597\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l597: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l598\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l598: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l599\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l599: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l600\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l600: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l601\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l601: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l602\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l602: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l603\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l603: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l604\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l604: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l605\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l605: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l606\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l606: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l607\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l607: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l608\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l608: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l609\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l609: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l610\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l610: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l611\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l611: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l612\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l612: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l613\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l613: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l614\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l614: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l615\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l615: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l616\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l616: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l617\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l617: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l618\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l618: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l619\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l619: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l620\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l620: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l621\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l621: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l622\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l622: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l623\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l623: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l624\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l624: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l625\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l625: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l626\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l626: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l627\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l627: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l628\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l628: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l629\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l629: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l630\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l630: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l631\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l631: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l632\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l632: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l633\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l633: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l634\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l634: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l635\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l635: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l636\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l636: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l637\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l637: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l638\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l638: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l639\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l639: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l640\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l640: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l641\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l641: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l642\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l642: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l643\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l643: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l644\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l644: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l645\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l645: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l646\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l646: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l647\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l647: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l648\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l648: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l649\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l649: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l650\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l650: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l651\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l651: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l652\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l652: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l653\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l653: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l654\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l654: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l655\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l655: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l656\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l656: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l657\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l657: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l658\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l658: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l659\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l659: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l660\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l660: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l661\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l661: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l662\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l662: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l663\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l663: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l664\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l664: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l665\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l665: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l666\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l666: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l667\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l667: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l668\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l668: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l669\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l669: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l670\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l670: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l671\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l671: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l672\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l672: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l673\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l673: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l674\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l674: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l675\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l675: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l676\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l676: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l677\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l677: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l678\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l678: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l679\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l679: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l680\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l680: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l681\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l681: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l682\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l682: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l683\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l683: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l684\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l684: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l685\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l685: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l686\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l686: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l687\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l687: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l688\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l688: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l689\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l689: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l690\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l690: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l691\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l691: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l692\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l692: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l693\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l693: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l694\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l694: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l695\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l695: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l696\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l696: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l697\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l697: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l698\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l698: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l699\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l699: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l700\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l700: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l701\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l701: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l702\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l702: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l703\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l703: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l704\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l704: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l705\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l705: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l706\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l706: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l707\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l707: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l708\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l708: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l709\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l709: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l710\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l710: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l711\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l711: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l712\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l712: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l713\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l713: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l714\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l714: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l715\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l715: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l716\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l716: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l717\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l717: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l718\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l718: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l719\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l719: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l720\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l720: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l721\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l721: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l722\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l722: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l723\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l723: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l724\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l724: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l725\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l725: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l726\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l726: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l727\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l727: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l728\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l728: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l729\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l729: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l730\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l730: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l731\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l731: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l732\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l732: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l733\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l733: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l734\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l734: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l735\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l735: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l736\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l736: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l737\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l737: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l738\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l738: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l739\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l739: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l740\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l740: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l741\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l741: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l742\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l742: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l743\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l743: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l744\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l744: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l745\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l745: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l746\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l746: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l747\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l747: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l748\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l748: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l749\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l749: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l750\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l750: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l751\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l751: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l752\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l752: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l753\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l753: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l754\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l754: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l755\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l755: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l756\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l756: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l757\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l757: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l758\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l758: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l759\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l759: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l760\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l760: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l761\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l761: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l762\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l762: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l763\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l763: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l764\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l764: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l765\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l765: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l766\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l766: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l767\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l767: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l768\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l768: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l769\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l769: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l770\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l770: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l771\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l771: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l772\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l772: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l773\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l773: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l774\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l774: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l775\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l775: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l776\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l776: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l777\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l777: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l778\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l778: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l779\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l779: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l780\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l780: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l781\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l781: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l782\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l782: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l783\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l783: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l784\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l784: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l785\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l785: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l786\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l786: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l787\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l787: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l788\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l788: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l789\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l789: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l790\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l790: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l791\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l791: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l792\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l792: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l793\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l793: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l794\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l794: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l795\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l795: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l796\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l796: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l797\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l797: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l798\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l798: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l799\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l799: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l800\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l800: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l801\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l801: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l802\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l802: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l803\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l803: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l804\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l804: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l805\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l805: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l806\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l806: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l807\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l807: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l808\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l808: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l809\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l809: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l810\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l810: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l811\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l811: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l812\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l812: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l813\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l813: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l814\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l814: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l815\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l815: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l816\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l816: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l817\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l817: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l818\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l818: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l819\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l819: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l820\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l820: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l821\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l821: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l822\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l822: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l823\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l823: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l824\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l824: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l825\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l825: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l826\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l826: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l827\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l827: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l828\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l828: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l829\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l829: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l830\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l830: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l831\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l831: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l832\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l832: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l833\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l833: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l834\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l834: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l835\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l835: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l836\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l836: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l837\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l837: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l838\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l838: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l839\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l839: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l840\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l840: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l841\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l841: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l842\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l842: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l843\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l843: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l844\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l844: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l845\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l845: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l846\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l846: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l847\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l847: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l848\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l848: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l849\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l849: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l850\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l850: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l851\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l851: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l852\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l852: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l853\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l853: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l854\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l854: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l855\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l855: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l856\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l856: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l857\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l857: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l858\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l858: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l859\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l859: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l860\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l860: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l861\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l861: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l862\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l862: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l863\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l863: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l864\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l864: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l865\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l865: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l866\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l866: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l867\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l867: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l868\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l868: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l869\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l869: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l870\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l870: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l871\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l871: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l872\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l872: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l873\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l873: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l874\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l874: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l875\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l875: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l876\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l876: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l877\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l877: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l878\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l878: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l879\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l879: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l880\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l880: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l881\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l881: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l882\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l882: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l883\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l883: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l884\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l884: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l885\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l885: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l886\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l886: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l887\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l887: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l888\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l888: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l889\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l889: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l890\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l890: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l891\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l891: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l892\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l892: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l893\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l893: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l894\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l894: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l895\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l895: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l896\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l896: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l897\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l897: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l898\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l898: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l899\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l899: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l900\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l900: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l901\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l901: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l902\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l902: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l903\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l903: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l904\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l904: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l905\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l905: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l906\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l906: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l907\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l907: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l908\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l908: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l909\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l909: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l910\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l910: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l911\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l911: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l912\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l912: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l913\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l913: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l914\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l914: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l915\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l915: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l916\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l916: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l917\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l917: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l918\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l918: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l919\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l919: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l920\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l920: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l921\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l921: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l922\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l922: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l923\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l923: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l924\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l924: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l925\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l925: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l926\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l926: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l927\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l927: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l928\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l928: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l929\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l929: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l930\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l930: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l931\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l931: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l932\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l932: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l933\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l933: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l934\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l934: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l935\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l935: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l936\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l936: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l937\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l937: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l938\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l938: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l939\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l939: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l940\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l940: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l941\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l941: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l942\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l942: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l943\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l943: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l944\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l944: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l945\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l945: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l946\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l946: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l947\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l947: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l948\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l948: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l949\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l949: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l950\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l950: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l951\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l951: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l952\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l952: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l953\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l953: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l954\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l954: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l955\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l955: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l956\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l956: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l957\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l957: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l958\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l958: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l959\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l959: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l960\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l960: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l961\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l961: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l962\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l962: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l963\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l963: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l964\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l964: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l965\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l965: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l966\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l966: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l967\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l967: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l968\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l968: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l969\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l969: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l970\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l970: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l971\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l971: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l972\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l972: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l973\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l973: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l974\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l974: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l975\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l975: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l976\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l976: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l977\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l977: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l978\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l978: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l979\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l979: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l980\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l980: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l981\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l981: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l982\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l982: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l983\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l983: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l984\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l984: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l985\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l985: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l986\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l986: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l987\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l987: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l988\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l988: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l989\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l989: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l990\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l990: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l991\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l991: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l992\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l992: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l993\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l993: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l994\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l994: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l995\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l995: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l996\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l996: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l997\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l997: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l998\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l998: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l999\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l999: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1000\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1000: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1001\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1001: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1002\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1002: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1003\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1003: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1004\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1004: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1005\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1005: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1006\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1006: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1007\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1007: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1008\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1008: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1009\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1009: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1010\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1010: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1011\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1011: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1012\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1012: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1013\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1013: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1014\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1014: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1015\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1015: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1016\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1016: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1017\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1017: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1018\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1018: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1019\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1019: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1020\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1020: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1021\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1021: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1022\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1022: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1023\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1023: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1024\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1024: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1025\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1025: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1026\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1026: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1027\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1027: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1028\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1028: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1029\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1029: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1030\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1030: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1031\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1031: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1032\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1032: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1033\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1033: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1034\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1034: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1035\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1035: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1036\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1036: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1037\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1037: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1038\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1038: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1039\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1039: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1040\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1040: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1041\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1041: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1042\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1042: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1043\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1043: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1044\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1044: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1045\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1045: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1046\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1046: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1047\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1047: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1048\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1048: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1049\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1049: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1050\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1050: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1051\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1051: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1052\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1052: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1053\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1053: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1054\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1054: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1055\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1055: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1056\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1056: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1057\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1057: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1058\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1058: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1059\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1059: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1060\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1060: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1061\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1061: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1062\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1062: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1063\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1063: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1064\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1064: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1065\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1065: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1066\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1066: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1067\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1067: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1068\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1068: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1069\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1069: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1070\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1070: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1071\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1071: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1072\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1072: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1073\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1073: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1074\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1074: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1075\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1075: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1076\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1076: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1077\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1077: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1078\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1078: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1079\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1079: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1080\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1080: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1081\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1081: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1082\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1082: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1083\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1083: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1084\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1084: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1085\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1085: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1086\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1086: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1087\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1087: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1088\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1088: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1089\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1089: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1090\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1090: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1091\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1091: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1092\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1092: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1093\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1093: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1094\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1094: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1095\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1095: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1096\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1096: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1097\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1097: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1098\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1098: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1099\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1099: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1100\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1100: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1101\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1101: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1102\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1102: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1103\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1103: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1104\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1104: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1105\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1105: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1106\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1106: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1107\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1107: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1108\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1108: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1109\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1109: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1110\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1110: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1111\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1111: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1112\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1112: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1113\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1113: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1114\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1114: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1115\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1115: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1116\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1116: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1117\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1117: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1118\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1118: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1119\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1119: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1120\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1120: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1121\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1121: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1122\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1122: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1123\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1123: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1124\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1124: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1125\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1125: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1126\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1126: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1127\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1127: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1128\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1128: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1129\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1129: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1130\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1130: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1131\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1131: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1132\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1132: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1133\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1133: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1134\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1134: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1135\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1135: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1136\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1136: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1137\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1137: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1138\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1138: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1139\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1139: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1140\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1140: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1141\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1141: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1142\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1142: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1143\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1143: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1144\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1144: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1145\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1145: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1146\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1146: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1147\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1147: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1148\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1148: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1149\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1149: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1150\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1150: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1151\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1151: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1152\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1152: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1153\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1153: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1154\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1154: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1155\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1155: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1156\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1156: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1157\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1157: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1158\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1158: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1159\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1159: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1160\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1160: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1161\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1161: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1162\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1162: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1163\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1163: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1164\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1164: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1165\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1165: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1166\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1166: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1167\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1167: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1168\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1168: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1169\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1169: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1170\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1170: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1171\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1171: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1172\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1172: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1173\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1173: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1174\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1174: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1175\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1175: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1176\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1176: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1177\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1177: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1178\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1178: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1179\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1179: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1180\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1180: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1181\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1181: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1182\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1182: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1183\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1183: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1184\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1184: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1185\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1185: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1186\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1186: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1187\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1187: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1188\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1188: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1189\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1189: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1190\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1190: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1191\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1191: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1192\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1192: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1193\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1193: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1194\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1194: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1195\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1195: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1196\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1196: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1197\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1197: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1198\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1198: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1199\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1199: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1200\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1200: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1201\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1201: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1202\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1202: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1203\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1203: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1204\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1204: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1205\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1205: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1206\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1206: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1207\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1207: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1208\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1208: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1209\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1209: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1210\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1210: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1211\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1211: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1212\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1212: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1213\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1213: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1214\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1214: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1215\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1215: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1216\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1216: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1217\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1217: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1218\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1218: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1219\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1219: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1220\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1220: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1221\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1221: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1222\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1222: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1223\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1223: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1224\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1224: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1225\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1225: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1226\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1226: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1227\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1227: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1228\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1228: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1229\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1229: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1230\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1230: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1231\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1231: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1232\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1232: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1233\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1233: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1234\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1234: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1235\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1235: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1236\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1236: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1237\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1237: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1238\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1238: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1239\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1239: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1240\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1240: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1241\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1241: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1242\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1242: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1243\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1243: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1244\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1244: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1245\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1245: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1246\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1246: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1247\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1247: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1248\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1248: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1249\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1249: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1250\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1250: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1251\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1251: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1252\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1252: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1253\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1253: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1254\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1254: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1255\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1255: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1256\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1256: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1257\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1257: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1258\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1258: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1259\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1259: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1260\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1260: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1261\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1261: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1262\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1262: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1263\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1263: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1264\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1264: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1265\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1265: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1266\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1266: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1267\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1267: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1268\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1268: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1269\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1269: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1270\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1270: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1271\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1271: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1272\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1272: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1273\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1273: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1274\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1274: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1275\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1275: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1276\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1276: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1277\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1277: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1278\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1278: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1279\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1279: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1280\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1280: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1281\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1281: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1282\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1282: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1283\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1283: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1284\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1284: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1285\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1285: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1286\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1286: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1287\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1287: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1288\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1288: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1289\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1289: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1290\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1290: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1291\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1291: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1292\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1292: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1293\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1293: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1294\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1294: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1295\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1295: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1296\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1296: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1297\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1297: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1298\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1298: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1299\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1299: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1300\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1300: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1301\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1301: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1302\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1302: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1303\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1303: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1304\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1304: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1305\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1305: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1306\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1306: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1307\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1307: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1308\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1308: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1309\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1309: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1310\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1310: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1311\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1311: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1312\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1312: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1313\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1313: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1314\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1314: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1315\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1315: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1316\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1316: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1317\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1317: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1318\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1318: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1319\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1319: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1320\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1320: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1321\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1321: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1322\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1322: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1323\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1323: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1324\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1324: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1325\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1325: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1326\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1326: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1327\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1327: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1328\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1328: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1329\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1329: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1330\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1330: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1331\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1331: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1332\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1332: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1333\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1333: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1334\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1334: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1335\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1335: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1336\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1336: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1337\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1337: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1338\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1338: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1339\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1339: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1340\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1340: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1341\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1341: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1342\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1342: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1343\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1343: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1344\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1344: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1345\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1345: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1346\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1346: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1347\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1347: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1348\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1348: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1349\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1349: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1350\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1350: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1351\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1351: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1352\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1352: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1353\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1353: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1354\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1354: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1355\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1355: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1356\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1356: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1357\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1357: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1358\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1358: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1359\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1359: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1360\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1360: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1361\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1361: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1362\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1362: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1363\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1363: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1364\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1364: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1365\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1365: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1366\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1366: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1367\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1367: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1368\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1368: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1369\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1369: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1370\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1370: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1371\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1371: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1372\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1372: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1373\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1373: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1374\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1374: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1375\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1375: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1376\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1376: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1377\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1377: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1378\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1378: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1379\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1379: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1380\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1380: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1381\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1381: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1382\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1382: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1383\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1383: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1384\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1384: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1385\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1385: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1386\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1386: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1387\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1387: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1388\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1388: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1389\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1389: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1390\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1390: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1391\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1391: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1392\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1392: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1393\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1393: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1394\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1394: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1395\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1395: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1396\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1396: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1397\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1397: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1398\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1398: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1399\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1399: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1400\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1400: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1401\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1401: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1402\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1402: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1403\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1403: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1404\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1404: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1405\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1405: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1406\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1406: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1407\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1407: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1408\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1408: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1409\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1409: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1410\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1410: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1411\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1411: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1412\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1412: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1413\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1413: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1414\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1414: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1415\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1415: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1416\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1416: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1417\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1417: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1418\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1418: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1419\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1419: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1420\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1420: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1421\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1421: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1422\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1422: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1423\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1423: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1424\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1424: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1425\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1425: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1426\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1426: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1427\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1427: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1428\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1428: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1429\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1429: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1430\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1430: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1431\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1431: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1432\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1432: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1433\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1433: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1434\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1434: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1435\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1435: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1436\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1436: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1437\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1437: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1438\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1438: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1439\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1439: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1440\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1440: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1441\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1441: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1442\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1442: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1443\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1443: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1444\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1444: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1445\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1445: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1446\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1446: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1447\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1447: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1448\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1448: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1449\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1449: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1450\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1450: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1451\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1451: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1452\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1452: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1453\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1453: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1454\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1454: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1455\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1455: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1456\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1456: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1457\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1457: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1458\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1458: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1459\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1459: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1460\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1460: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1461\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1461: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1462\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1462: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1463\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1463: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1464\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1464: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1465\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1465: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1466\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1466: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1467\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1467: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1468\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1468: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1469\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1469: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1470\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1470: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1471\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1471: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1472\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1472: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1473\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1473: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1474\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1474: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1475\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1475: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1476\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1476: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1477\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1477: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1478\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1478: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1479\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1479: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1480\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1480: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1481\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1481: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1482\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1482: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1483\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1483: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1484\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1484: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1485\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1485: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1486\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1486: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1487\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1487: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1488\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1488: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1489\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1489: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1490\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1490: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1491\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1491: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1492\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1492: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1493\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1493: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1494\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1494: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1495\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1495: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1496\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1496: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1497\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1497: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1498\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1498: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1499\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1499: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1500\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1500: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1501\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1501: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1502\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1502: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1503\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1503: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1504\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1504: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1505\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1505: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1506\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1506: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1507\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1507: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1508\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1508: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1509\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1509: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1510\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1510: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1511\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1511: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1512\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1512: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1513\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1513: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1514\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1514: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1515\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1515: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1516\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1516: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1517\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1517: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1518\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1518: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1519\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1519: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1520\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1520: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1521\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1521: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1522\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1522: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1523\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1523: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1524\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1524: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1525\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1525: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1526\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1526: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1527\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1527: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1528\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1528: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1529\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1529: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1530\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1530: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1531\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1531: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1532\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1532: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1533\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1533: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1534\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1534: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1535\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1535: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1536\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1536: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1537\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1537: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1538\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1538: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1539\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1539: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1540\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1540: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1541\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1541: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1542\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1542: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1543\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1543: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1544\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1544: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1545\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1545: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1546\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1546: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1547\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1547: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1548\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1548: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1549\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1549: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1550\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1550: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1551\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1551: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1552\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1552: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1553\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1553: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1554\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1554: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1555\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1555: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1556\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1556: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1557\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1557: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1558\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1558: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1559\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1559: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1560\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1560: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1561\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1561: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1562\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1562: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1563\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1563: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1564\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1564: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1565\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1565: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1566\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1566: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1567\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1567: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1568\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1568: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1569\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1569: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1570\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1570: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1571\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1571: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1572\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1572: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1573\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1573: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1574\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1574: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1575\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1575: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1576\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1576: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1577\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1577: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1578\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1578: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1579\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1579: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1580\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1580: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1581\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1581: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1582\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1582: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1583\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1583: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1584\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1584: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1585\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1585: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1586\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1586: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1587\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1587: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1588\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1588: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1589\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1589: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1590\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1590: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1591\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1591: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1592\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1592: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1593\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1593: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1594\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1594: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1595\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1595: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1596\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1596: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1597\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1597: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1598\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1598: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1599\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1599: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1600\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1600: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1601\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1601: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1602\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1602: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1603\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1603: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1604\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1604: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1605\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1605: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1606\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1606: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1607\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1607: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1608\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1608: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1609\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1609: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1610\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1610: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1611\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1611: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1612\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1612: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1613\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1613: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1614\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1614: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1615\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1615: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1616\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1616: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1617\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1617: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1618\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1618: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1619\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1619: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1620\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1620: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1621\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1621: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1622\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1622: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1623\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1623: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1624\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1624: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1625\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1625: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1626\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1626: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1627\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1627: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1628\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1628: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1629\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1629: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1630\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1630: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1631\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1631: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1632\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1632: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1633\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1633: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1634\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1634: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1635\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1635: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1636\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1636: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1637\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1637: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1638\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1638: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1639\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1639: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1640\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1640: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1641\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1641: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1642\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1642: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1643\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1643: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1644\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1644: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1645\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1645: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1646\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1646: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1647\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1647: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1648\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1648: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1649\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1649: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1650\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1650: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1651\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1651: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1652\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1652: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1653\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1653: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1654\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1654: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1655\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1655: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1656\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1656: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1657\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1657: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1658\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1658: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1659\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1659: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1660\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1660: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1661\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1661: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1662\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1662: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1663\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1663: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1664\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1664: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1665\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1665: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1666\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1666: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1667\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1667: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1668\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1668: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1669\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1669: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1670\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1670: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1671\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1671: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1672\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1672: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1673\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1673: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1674\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1674: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1675\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1675: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1676\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1676: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1677\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1677: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1678\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1678: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1679\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1679: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1680\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1680: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1681\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1681: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1682\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1682: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1683\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1683: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1684\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1684: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1685\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1685: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1686\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1686: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1687\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1687: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1688\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1688: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1689\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1689: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1690\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1690: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1691\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1691: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1692\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1692: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1693\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1693: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1694\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1694: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1695\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1695: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1696\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1696: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1697\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1697: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1698\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1698: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1699\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1699: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1700\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1700: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1701\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1701: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1702\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1702: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1703\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1703: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1704\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1704: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1705\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1705: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1706\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1706: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1707\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1707: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1708\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1708: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1709\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1709: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1710\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1710: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1711\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1711: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1712\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1712: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1713\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1713: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1714\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1714: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1715\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1715: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1716\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1716: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1717\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1717: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1718\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1718: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1719\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1719: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1720\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1720: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1721\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1721: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1722\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1722: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1723\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1723: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1724\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1724: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1725\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1725: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1726\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1726: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1727\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1727: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1728\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1728: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1729\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1729: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1730\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1730: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1731\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1731: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1732\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1732: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1733\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1733: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1734\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1734: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1735\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1735: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1736\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1736: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1737\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1737: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1738\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1738: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1739\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1739: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1740\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1740: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1741\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1741: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1742\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1742: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1743\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1743: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1744\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1744: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1745\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1745: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1746\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1746: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1747\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1747: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1748\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1748: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1749\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1749: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1750\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1750: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1751\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1751: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1752\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1752: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1753\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1753: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1754\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1754: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1755\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1755: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1756\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1756: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1757\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1757: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1758\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1758: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1759\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1759: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1760\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1760: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1761\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1761: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1762\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1762: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1763\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1763: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1764\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1764: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1765\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1765: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1766\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1766: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1767\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1767: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1768\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1768: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1769\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1769: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1770\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1770: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1771\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1771: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1772\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1772: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1773\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1773: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1774\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1774: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1775\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1775: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1776\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1776: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1777\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1777: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1778\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1778: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1779\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1779: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1780\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1780: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1781\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1781: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1782\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1782: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1783\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1783: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1784\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1784: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1785\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1785: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1786\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1786: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1787\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1787: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1788\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1788: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1789\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1789: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1790\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1790: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1791\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1791: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1792\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1792: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1793\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1793: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1794\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1794: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1795\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1795: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1796\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1796: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1797\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1797: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1798\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1798: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1799\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1799: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1800\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1800: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1801\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1801: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1802\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1802: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1803\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1803: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1804\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1804: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1805\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1805: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1806\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1806: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1807\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1807: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1808\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1808: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1809\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1809: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1810\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1810: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1811\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1811: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1812\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1812: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1813\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1813: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1814\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1814: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1815\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1815: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1816\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1816: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1817\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1817: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1818\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1818: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1819\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1819: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1820\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1820: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1821\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1821: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1822\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1822: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1823\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1823: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1824\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1824: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1825\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1825: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1826\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1826: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1827\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1827: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1828\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1828: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1829\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1829: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1830\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1830: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1831\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1831: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1832\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1832: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1833\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1833: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1834\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1834: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1835\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1835: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1836\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1836: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1837\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1837: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1838\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1838: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1839\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1839: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1840\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1840: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1841\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1841: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1842\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1842: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1843\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1843: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1844\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1844: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1845\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1845: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1846\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1846: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1847\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1847: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1848\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1848: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1849\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1849: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1850\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1850: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1851\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1851: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1852\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1852: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1853\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1853: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1854\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1854: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1855\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1855: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1856\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1856: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1857\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1857: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1858\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1858: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1859\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1859: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1860\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1860: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1861\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1861: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1862\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1862: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1863\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1863: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1864\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1864: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1865\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1865: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1866\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1866: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1867\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1867: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1868\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1868: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1869\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1869: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1870\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1870: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1871\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1871: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1872\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1872: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1873\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1873: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1874\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1874: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1875\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1875: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1876\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1876: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1877\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1877: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1878\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1878: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1879\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1879: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1880\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1880: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1881\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1881: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1882\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1882: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1883\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1883: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1884\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1884: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1885\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1885: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1886\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1886: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1887\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1887: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1888\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1888: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1889\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1889: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1890\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1890: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1891\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1891: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1892\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1892: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1893\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1893: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1894\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1894: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1895\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1895: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1896\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1896: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1897\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1897: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1898\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1898: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1899\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1899: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1900\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1900: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1901\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1901: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1902\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1902: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1903\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1903: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1904\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1904: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1905\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1905: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1906\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1906: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1907\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1907: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1908\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1908: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1909\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1909: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1910\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1910: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1911\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1911: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1912\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1912: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1913\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1913: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1914\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1914: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1915\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1915: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1916\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1916: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1917\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1917: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1918\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1918: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1919\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1919: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1920\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1920: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1921\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1921: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1922\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1922: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1923\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1923: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1924\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1924: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1925\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1925: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1926\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1926: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1927\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1927: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1928\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1928: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1929\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1929: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1930\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1930: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1931\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1931: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1932\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1932: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1933\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1933: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1934\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1934: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1935\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1935: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1936\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1936: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1937\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1937: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1938\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1938: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1939\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1939: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1940\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1940: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1941\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1941: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1942\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1942: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1943\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1943: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1944\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1944: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1945\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1945: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1946\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1946: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1947\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1947: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1948\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1948: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1949\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1949: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1950\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1950: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1951\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1951: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1952\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1952: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1953\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1953: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1954\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1954: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1955\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1955: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1956\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1956: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1957\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1957: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1958\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1958: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1959\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1959: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1960\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1960: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1961\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1961: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1962\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1962: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1963\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1963: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1964\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1964: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1965\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1965: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1966\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1966: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1967\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1967: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1968\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1968: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1969\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1969: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1970\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1970: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1971\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1971: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1972\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1972: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1973\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1973: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1974\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1974: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1975\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1975: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1976\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1976: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1977\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1977: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1978\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1978: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1979\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1979: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1980\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1980: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1981\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1981: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1982\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1982: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1983\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1983: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1984\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1984: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1985\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1985: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1986\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1986: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1987\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1987: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1988\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1988: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1989\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1989: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1990\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1990: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1991\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1991: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1992\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1992: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1993\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1993: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1994\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1994: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1995\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1995: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1996\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1996: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1997\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1997: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1998\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1998: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l1999\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l1999: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2000\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2000: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2001\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2001: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2002\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2002: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2003\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2003: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2004\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2004: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2005\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2005: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2006\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2006: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2007\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2007: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2008\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2008: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2009\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2009: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2010\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2010: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2011\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2011: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2012\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2012: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2013\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2013: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2014\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2014: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2015\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2015: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2016\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2016: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2017\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2017: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2018\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2018: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2019\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2019: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2020\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2020: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2021\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2021: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2022\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2022: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2023\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2023: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2024\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2024: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2025\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2025: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2026\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2026: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2027\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2027: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2028\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2028: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2029\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2029: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2030\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2030: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2031\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2031: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2032\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2032: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2033\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2033: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2034\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2034: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2035\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2035: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2036\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2036: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2037\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2037: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2038\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2038: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2039\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2039: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2040\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2040: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2041\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2041: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2042\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2042: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2043\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2043: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2044\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2044: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2045\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2045: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2046\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2046: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2047\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2047: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2048\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2048: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2049\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2049: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2050\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2050: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2051\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2051: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2052\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2052: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2053\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2053: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2054\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2054: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2055\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2055: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2056\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2056: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2057\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2057: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2058\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2058: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2059\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2059: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2060\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2060: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2061\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2061: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2062\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2062: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2063\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2063: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2064\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2064: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2065\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2065: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2066\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2066: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2067\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2067: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2068\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2068: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2069\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2069: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2070\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2070: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2071\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2071: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2072\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2072: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2073\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2073: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2074\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2074: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2075\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2075: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2076\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2076: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2077\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2077: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2078\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2078: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2079\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2079: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2080\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2080: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2081\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2081: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2082\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2082: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2083\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2083: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2084\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2084: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2085\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2085: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2086\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2086: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2087\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2087: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2088\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2088: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2089\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2089: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2090\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2090: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2091\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2091: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2092\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2092: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2093\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2093: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2094\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2094: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2095\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2095: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2096\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2096: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2097\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2097: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2098\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2098: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2099\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2099: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2100\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2100: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2101\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2101: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2102\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2102: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2103\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2103: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2104\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2104: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2105\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2105: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2106\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2106: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2107\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2107: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2108\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2108: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2109\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2109: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2110\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2110: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2111\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2111: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2112\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2112: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2113\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2113: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2114\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2114: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2115\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2115: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2116\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2116: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2117\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2117: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2118\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2118: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2119\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2119: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2120\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2120: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2121\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2121: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2122\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2122: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2123\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2123: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2124\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2124: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2125\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2125: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2126\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2126: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2127\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2127: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2128\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2128: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2129\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2129: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2130\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2130: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2131\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2131: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2132\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2132: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2133\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2133: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2134\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2134: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2135\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2135: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2136\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2136: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2137\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2137: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2138\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2138: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2139\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2139: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2140\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2140: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2141\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2141: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2142\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2142: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2143\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2143: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2144\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2144: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2145\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2145: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2146\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2146: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2147\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2147: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2148\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2148: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2149\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2149: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2150\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2150: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2151\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2151: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2152\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2152: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2153\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2153: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2154\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2154: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2155\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2155: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2156\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2156: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2157\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2157: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2158\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2158: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2159\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2159: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2160\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2160: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2161\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2161: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2162\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2162: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2163\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2163: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2164\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2164: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2165\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2165: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2166\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2166: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2167\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2167: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2168\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2168: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2169\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2169: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2170\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2170: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2171\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2171: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2172\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2172: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2173\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2173: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2174\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2174: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2175\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2175: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2176\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2176: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2177\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2177: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2178\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2178: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2179\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2179: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2180\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2180: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2181\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2181: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2182\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2182: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2183\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2183: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2184\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2184: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2185\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2185: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2186\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2186: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2187\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2187: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2188\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2188: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2189\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2189: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2190\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2190: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2191\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2191: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2192\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2192: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2193\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2193: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2194\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2194: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2195\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2195: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2196\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2196: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2197\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2197: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2198\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2198: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2199\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2199: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2200\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2200: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2201\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2201: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2202\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2202: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2203\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2203: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2204\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2204: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2205\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2205: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2206\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2206: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2207\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2207: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2208\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2208: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2209\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2209: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2210\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2210: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2211\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2211: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2212\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2212: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2213\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2213: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2214\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2214: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2215\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2215: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2216\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2216: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2217\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2217: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2218\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2218: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2219\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2219: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2220\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2220: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2221\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2221: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2222\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2222: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2223\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2223: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2224\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2224: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2225\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2225: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2226\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2226: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2227\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2227: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2228\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2228: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2229\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2229: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2230\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2230: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2231\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2231: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2232\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2232: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2233\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2233: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2234\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2234: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2235\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2235: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2236\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2236: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2237\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2237: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2238\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2238: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2239\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2239: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2240\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2240: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2241\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2241: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2242\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2242: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2243\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2243: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2244\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2244: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2245\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2245: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2246\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2246: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2247\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2247: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2248\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2248: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2249\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2249: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2250\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2250: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2251\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2251: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2252\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2252: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2253\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2253: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2254\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2254: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2255\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2255: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2256\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2256: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2257\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2257: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2258\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2258: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2259\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2259: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2260\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2260: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2261\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2261: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2262\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2262: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2263\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2263: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2264\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2264: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2265\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2265: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2266\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2266: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2267\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2267: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2268\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2268: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2269\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2269: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2270\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2270: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2271\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2271: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2272\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2272: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2273\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2273: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2274\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2274: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2275\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2275: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2276\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2276: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2277\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2277: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2278\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2278: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2279\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2279: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2280\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2280: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2281\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2281: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2282\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2282: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2283\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2283: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2284\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2284: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2285\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2285: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2286\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2286: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2287\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2287: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2288\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2288: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2289\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2289: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2290\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2290: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2291\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2291: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2292\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2292: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2293\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2293: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2294\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2294: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2295\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2295: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2296\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2296: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2297\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2297: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2298\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2298: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2299\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2299: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2300\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2300: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2301\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2301: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2302\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2302: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2303\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2303: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2304\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2304: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2305\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2305: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2306\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2306: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2307\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2307: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2308\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2308: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2309\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2309: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2310\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2310: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2311\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2311: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2312\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2312: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2313\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2313: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2314\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2314: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2315\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2315: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2316\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2316: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2317\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2317: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2318\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2318: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2319\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2319: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2320\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2320: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2321\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2321: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2322\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2322: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2323\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2323: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2324\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2324: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2325\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2325: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2326\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2326: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2327\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2327: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2328\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2328: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2329\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2329: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2330\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2330: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2331\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2331: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2332\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2332: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2333\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2333: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2334\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2334: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2335\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2335: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2336\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2336: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2337\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2337: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2338\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2338: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2339\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2339: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2340\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2340: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2341\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2341: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2342\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2342: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2343\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2343: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2344\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2344: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2345\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2345: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2346\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2346: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2347\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2347: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2348\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2348: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2349\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2349: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2350\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2350: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2351\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2351: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2352\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2352: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2353\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2353: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2354\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2354: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2355\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2355: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2356\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2356: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2357\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2357: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2358\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2358: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2359\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2359: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2360\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2360: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2361\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2361: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2362\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2362: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2363\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2363: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2364\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2364: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2365\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2365: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2366\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2366: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2367\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2367: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2368\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2368: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2369\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2369: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2370\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2370: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2371\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2371: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2372\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2372: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2373\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2373: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2374\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2374: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2375\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2375: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2376\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2376: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2377\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2377: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2378\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2378: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2379\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2379: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2380\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2380: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2381\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2381: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2382\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2382: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2383\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2383: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2384\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2384: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2385\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2385: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2386\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2386: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2387\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2387: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2388\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2388: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2389\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2389: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2390\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2390: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2391\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2391: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2392\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2392: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2393\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2393: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2394\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2394: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2395\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2395: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2396\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2396: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2397\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2397: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2398\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2398: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2399\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2399: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2400\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2400: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2401\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2401: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2402\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2402: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2403\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2403: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2404\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2404: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2405\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2405: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2406\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2406: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2407\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2407: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2408\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2408: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2409\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2409: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2410\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2410: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2411\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2411: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2412\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2412: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2413\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2413: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2414\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2414: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2415\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2415: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2416\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2416: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2417\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2417: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2418\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2418: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2419\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2419: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2420\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2420: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2421\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2421: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2422\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2422: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2423\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2423: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2424\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2424: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2425\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2425: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2426\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2426: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2427\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2427: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2428\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2428: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2429\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2429: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2430\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2430: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2431\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2431: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2432\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2432: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2433\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2433: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2434\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2434: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2435\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2435: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2436\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2436: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2437\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2437: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2438\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2438: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2439\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2439: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2440\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2440: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2441\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2441: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2442\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2442: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2443\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2443: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2444\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2444: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2445\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2445: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2446\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2446: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2447\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2447: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2448\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2448: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2449\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2449: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2450\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2450: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2451\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2451: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2452\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2452: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2453\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2453: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2454\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2454: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2455\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2455: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2456\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2456: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2457\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2457: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2458\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2458: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2459\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2459: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2460\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2460: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2461\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2461: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2462\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2462: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2463\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2463: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2464\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2464: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2465\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2465: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2466\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2466: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2467\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2467: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2468\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2468: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2469\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2469: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2470\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2470: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2471\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2471: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2472\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2472: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2473\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2473: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2474\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2474: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2475\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2475: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2476\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2476: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2477\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2477: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2478\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2478: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2479\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2479: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2480\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2480: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2481\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2481: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2482\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2482: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2483\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2483: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2484\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2484: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2485\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2485: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2486\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2486: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2487\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2487: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2488\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2488: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2489\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2489: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2490\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2490: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2491\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2491: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2492\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2492: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2493\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2493: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2494\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2494: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2495\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2495: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2496\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2496: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2497\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2497: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2498\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2498: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2499\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2499: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2500\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2500: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2501\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2501: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2502\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2502: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2503\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2503: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2504\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2504: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2505\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2505: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2506\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2506: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2507\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2507: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2508\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2508: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2509\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2509: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2510\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2510: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2511\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2511: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2512\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2512: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2513\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2513: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2514\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2514: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2515\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2515: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2516\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2516: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2517\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2517: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2518\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2518: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2519\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2519: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2520\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2520: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2521\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2521: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2522\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2522: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2523\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2523: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2524\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2524: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2525\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2525: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2526\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2526: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2527\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2527: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2528\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2528: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2529\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2529: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2530\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2530: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2531\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2531: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2532\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2532: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2533\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2533: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2534\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2534: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2535\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2535: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2536\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2536: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2537\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2537: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2538\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2538: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2539\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2539: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2540\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2540: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2541\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2541: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2542\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2542: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2543\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2543: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2544\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2544: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2545\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2545: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2546\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2546: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2547\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2547: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2548\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2548: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2549\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2549: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2550\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2550: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2551\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2551: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2552\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2552: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2553\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2553: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2554\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2554: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2555\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2555: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2556\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2556: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2557\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2557: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2558\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2558: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2559\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2559: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2560\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2560: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2561\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2561: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2562\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2562: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2563\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2563: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2564\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2564: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2565\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2565: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2566\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2566: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2567\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2567: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2568\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2568: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2569\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2569: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2570\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2570: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2571\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2571: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2572\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2572: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2573\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2573: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2574\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2574: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2575\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2575: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2576\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2576: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2577\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2577: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2578\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2578: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2579\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2579: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2580\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2580: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2581\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2581: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2582\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2582: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2583\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2583: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2584\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2584: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2585\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2585: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2586\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2586: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2587\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2587: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2588\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2588: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2589\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2589: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2590\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2590: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2591\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2591: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2592\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2592: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2593\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2593: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2594\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2594: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2595\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2595: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2596\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2596: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2597\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2597: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2598\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2598: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2599\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2599: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2600\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2600: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2601\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2601: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2602\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2602: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2603\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2603: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2604\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2604: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2605\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2605: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2606\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2606: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2607\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2607: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2608\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2608: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2609\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2609: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2610\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2610: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2611\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2611: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2612\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2612: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2613\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2613: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2614\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2614: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2615\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2615: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2616\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2616: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2617\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2617: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2618\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2618: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2619\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2619: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2620\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2620: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2621\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2621: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2622\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2622: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2623\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2623: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2624\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2624: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2625\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2625: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2626\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2626: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2627\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2627: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2628\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2628: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2629\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2629: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2630\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2630: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2631\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2631: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2632\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2632: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2633\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2633: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2634\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2634: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2635\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2635: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2636\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2636: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2637\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2637: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2638\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2638: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2639\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2639: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2640\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2640: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2641\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2641: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2642\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2642: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2643\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2643: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2644\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2644: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2645\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2645: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2646\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2646: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2647\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2647: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2648\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2648: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2649\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2649: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2650\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2650: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2651\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2651: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2652\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2652: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2653\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2653: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2654\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2654: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2655\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2655: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2656\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2656: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2657\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2657: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2658\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2658: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2659\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2659: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2660\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2660: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2661\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2661: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2662\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2662: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2663\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2663: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2664\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2664: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2665\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2665: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2666\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2666: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2667\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2667: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2668\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2668: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2669\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2669: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2670\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2670: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2671\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2671: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2672\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2672: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2673\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2673: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2674\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2674: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2675\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2675: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2676\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2676: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2677\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2677: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2678\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2678: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2679\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2679: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2680\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2680: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2681\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2681: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2682\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2682: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2683\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2683: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2684\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2684: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2685\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2685: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2686\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2686: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2687\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2687: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2688\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2688: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2689\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2689: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2690\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2690: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2691\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2691: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2692\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2692: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2693\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2693: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2694\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2694: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2695\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2695: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2696\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2696: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2697\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2697: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2698\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2698: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2699\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2699: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2700\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2700: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2701\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2701: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2702\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2702: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2703\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2703: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2704\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2704: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2705\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2705: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2706\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2706: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2707\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2707: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2708\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2708: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2709\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2709: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2710\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2710: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2711\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2711: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2712\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2712: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2713\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2713: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2714\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2714: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2715\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2715: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2716\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2716: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2717\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2717: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2718\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2718: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2719\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2719: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2720\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2720: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2721\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2721: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2722\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2722: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2723\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2723: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2724\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2724: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2725\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2725: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2726\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2726: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2727\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2727: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2728\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2728: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2729\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2729: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2730\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2730: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2731\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2731: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2732\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2732: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2733\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2733: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2734\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2734: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2735\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2735: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2736\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2736: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2737\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2737: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2738\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2738: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2739\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2739: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2740\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2740: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2741\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2741: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2742\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2742: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2743\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2743: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2744\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2744: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2745\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2745: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2746\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2746: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2747\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2747: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2748\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2748: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2749\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2749: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2750\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2750: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2751\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2751: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2752\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2752: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2753\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2753: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2754\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2754: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2755\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2755: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2756\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2756: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2757\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2757: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2758\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2758: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2759\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2759: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2760\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2760: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2761\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2761: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2762\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2762: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2763\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2763: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2764\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2764: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2765\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2765: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2766\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2766: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2767\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2767: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2768\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2768: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2769\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2769: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2770\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2770: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2771\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2771: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2772\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2772: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2773\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2773: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2774\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2774: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2775\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2775: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2776\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2776: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2777\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2777: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2778\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2778: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2779\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2779: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2780\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2780: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2781\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2781: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2782\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2782: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2783\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2783: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2784\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2784: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2785\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2785: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2786\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2786: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2787\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2787: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2788\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2788: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2789\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2789: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2790\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2790: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2791\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2791: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2792\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2792: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2793\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2793: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2794\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2794: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2795\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2795: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2796\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2796: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2797\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2797: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2798\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2798: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2799\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2799: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2800\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2800: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2801\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2801: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2802\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2802: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2803\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2803: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2804\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2804: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2805\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2805: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2806\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2806: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2807\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2807: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2808\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2808: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2809\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2809: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2810\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2810: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2811\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2811: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2812\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2812: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2813\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2813: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2814\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2814: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2815\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2815: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2816\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2816: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2817\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2817: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2818\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2818: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2819\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2819: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2820\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2820: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2821\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2821: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2822\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2822: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2823\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2823: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2824\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2824: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2825\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2825: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2826\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2826: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2827\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2827: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2828\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2828: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2829\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2829: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2830\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2830: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2831\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2831: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2832\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2832: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2833\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2833: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2834\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2834: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2835\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2835: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2836\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2836: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2837\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2837: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2838\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2838: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2839\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2839: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2840\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2840: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2841\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2841: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2842\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2842: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2843\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2843: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2844\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2844: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2845\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2845: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2846\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2846: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2847\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2847: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2848\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2848: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2849\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2849: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2850\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2850: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2851\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2851: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2852\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2852: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2853\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2853: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2854\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2854: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2855\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2855: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2856\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2856: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2857\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2857: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2858\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2858: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2859\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2859: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2860\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2860: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2861\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2861: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2862\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2862: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2863\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2863: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2864\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2864: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2865\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2865: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2866\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2866: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2867\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2867: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2868\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2868: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2869\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2869: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2870\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2870: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2871\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2871: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2872\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2872: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2873\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2873: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2874\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2874: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2875\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2875: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2876\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2876: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2877\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2877: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2878\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2878: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2879\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2879: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2880\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2880: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2881\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2881: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2882\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2882: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2883\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2883: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2884\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2884: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2885\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2885: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2886\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2886: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2887\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2887: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2888\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2888: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2889\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2889: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2890\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2890: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2891\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2891: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2892\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2892: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2893\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2893: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2894\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2894: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2895\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2895: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2896\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2896: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2897\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2897: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2898\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2898: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2899\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2899: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2900\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2900: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2901\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2901: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2902\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2902: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2903\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2903: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2904\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2904: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2905\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2905: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2906\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2906: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2907\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2907: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2908\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2908: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2909\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2909: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2910\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2910: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2911\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2911: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2912\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2912: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2913\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2913: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2914\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2914: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2915\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2915: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2916\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2916: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2917\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2917: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2918\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2918: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2919\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2919: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2920\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2920: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2921\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2921: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2922\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2922: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2923\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2923: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2924\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2924: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2925\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2925: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2926\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2926: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2927\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2927: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2928\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2928: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2929\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2929: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2930\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2930: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2931\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2931: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2932\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2932: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2933\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2933: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2934\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2934: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2935\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2935: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2936\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2936: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2937\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2937: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2938\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2938: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2939\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2939: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2940\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2940: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2941\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2941: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2942\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2942: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2943\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2943: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2944\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2944: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2945\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2945: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2946\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2946: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2947\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2947: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2948\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2948: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2949\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2949: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2950\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2950: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2951\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2951: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2952\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2952: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2953\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2953: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2954\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2954: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2955\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2955: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2956\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2956: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2957\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2957: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2958\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2958: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2959\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2959: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2960\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2960: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2961\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2961: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2962\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2962: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2963\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2963: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2964\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2964: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2965\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2965: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2966\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2966: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2967\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2967: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2968\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2968: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2969\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2969: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2970\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2970: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2971\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2971: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2972\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2972: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2973\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2973: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2974\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2974: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2975\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2975: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2976\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2976: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2977\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2977: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2978\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2978: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2979\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2979: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2980\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2980: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2981\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2981: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2982\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2982: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2983\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2983: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2984\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2984: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2985\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2985: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2986\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2986: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2987\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2987: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2988\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2988: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2989\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2989: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2990\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2990: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2991\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2991: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2992\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2992: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2993\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2993: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2994\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2994: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2995\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2995: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2996\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2996: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2997\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2997: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2998\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2998: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l2999\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l2999: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3000\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3000: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3001\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3001: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3002\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3002: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3003\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3003: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3004\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3004: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3005\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3005: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3006\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3006: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3007\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3007: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3008\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3008: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3009\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3009: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3010\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3010: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3011\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3011: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3012\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3012: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3013\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3013: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3014\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3014: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3015\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3015: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3016\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3016: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3017\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3017: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3018\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3018: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3019\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3019: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3020\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3020: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3021\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3021: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3022\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3022: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3023\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3023: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3024\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3024: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3025\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3025: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3026\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3026: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3027\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3027: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3028\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3028: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3029\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3029: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3030\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3030: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3031\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3031: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3032\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3032: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3033\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3033: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3034\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3034: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3035\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3035: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3036\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3036: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3037\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3037: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3038\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3038: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3039\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3039: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3040\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3040: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3041\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3041: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3042\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3042: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3043\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3043: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3044\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3044: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3045\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3045: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3046\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3046: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3047\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3047: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3048\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3048: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3049\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3049: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3050\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3050: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3051\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3051: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3052\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3052: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3053\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3053: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3054\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3054: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3055\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3055: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3056\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3056: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3057\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3057: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3058\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3058: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3059\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3059: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3060\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3060: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3061\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3061: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3062\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3062: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3063\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3063: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3064\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3064: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3065\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3065: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3066\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3066: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3067\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3067: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3068\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3068: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3069\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3069: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3070\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3070: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3071\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3071: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3072\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3072: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3073\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3073: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3074\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3074: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3075\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3075: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3076\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3076: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3077\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3077: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3078\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3078: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3079\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3079: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3080\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3080: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3081\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3081: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3082\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3082: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3083\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3083: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3084\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3084: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3085\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3085: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3086\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3086: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3087\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3087: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3088\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3088: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3089\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3089: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3090\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3090: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3091\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3091: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3092\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3092: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3093\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3093: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3094\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3094: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3095\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3095: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3096\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3096: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3097\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3097: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3098\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3098: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3099\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3099: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3100\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3100: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3101\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3101: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3102\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3102: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3103\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3103: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3104\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3104: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3105\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3105: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3106\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3106: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3107\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3107: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3108\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3108: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3109\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3109: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3110\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3110: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3111\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3111: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3112\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3112: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3113\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3113: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3114\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3114: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3115\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3115: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3116\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3116: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3117\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3117: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3118\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3118: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3119\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3119: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3120\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3120: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3121\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3121: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3122\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3122: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3123\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3123: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3124\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3124: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3125\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3125: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3126\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3126: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3127\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3127: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3128\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3128: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3129\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3129: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3130\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3130: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3131\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3131: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3132\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3132: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3133\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3133: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3134\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3134: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3135\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3135: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3136\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3136: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3137\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3137: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3138\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3138: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3139\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3139: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3140\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3140: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3141\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3141: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3142\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3142: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3143\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3143: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3144\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3144: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3145\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3145: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3146\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3146: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3147\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3147: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3148\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3148: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3149\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3149: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3150\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3150: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3151\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3151: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3152\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3152: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3153\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3153: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3154\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3154: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3155\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3155: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3156\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3156: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3157\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3157: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3158\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3158: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3159\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3159: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3160\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3160: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3161\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3161: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3162\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3162: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3163\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3163: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3164\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3164: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3165\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3165: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3166\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3166: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3167\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3167: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3168\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3168: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3169\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3169: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3170\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3170: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3171\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3171: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3172\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3172: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3173\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3173: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3174\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3174: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3175\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3175: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3176\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3176: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3177\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3177: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3178\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3178: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3179\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3179: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3180\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3180: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3181\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3181: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3182\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3182: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3183\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3183: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3184\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3184: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3185\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3185: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3186\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3186: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3187\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3187: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3188\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3188: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3189\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3189: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3190\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3190: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3191\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3191: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3192\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3192: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3193\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3193: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3194\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3194: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3195\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3195: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3196\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3196: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3197\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3197: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3198\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3198: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3199\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3199: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3200\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3200: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3201\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3201: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3202\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3202: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3203\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3203: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3204\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3204: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3205\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3205: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3206\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3206: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3207\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3207: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3208\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3208: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3209\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3209: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3210\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3210: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3211\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3211: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3212\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3212: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3213\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3213: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3214\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3214: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3215\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3215: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3216\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3216: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3217\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3217: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3218\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3218: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3219\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3219: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3220\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3220: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3221\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3221: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3222\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3222: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3223\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3223: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3224\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3224: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3225\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3225: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3226\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3226: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3227\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3227: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3228\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3228: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3229\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3229: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3230\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3230: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3231\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3231: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3232\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3232: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3233\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3233: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3234\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3234: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3235\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3235: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3236\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3236: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3237\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3237: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3238\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3238: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3239\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3239: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3240\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3240: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3241\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3241: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3242\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3242: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3243\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3243: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3244\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3244: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3245\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3245: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3246\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3246: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3247\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3247: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3248\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3248: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3249\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3249: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3250\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3250: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3251\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3251: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3252\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3252: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3253\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3253: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3254\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3254: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3255\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3255: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3256\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3256: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3257\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3257: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3258\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3258: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3259\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3259: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3260\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3260: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3261\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3261: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3262\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3262: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3263\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3263: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3264\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3264: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3265\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3265: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3266\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3266: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3267\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3267: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3268\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3268: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3269\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3269: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3270\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3270: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3271\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3271: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3272\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3272: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3273\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3273: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3274\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3274: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3275\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3275: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3276\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3276: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3277\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3277: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3278\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3278: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3279\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3279: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3280\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3280: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3281\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3281: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3282\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3282: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3283\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3283: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3284\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3284: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3285\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3285: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3286\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3286: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3287\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3287: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3288\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3288: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3289\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3289: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3290\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3290: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3291\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3291: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3292\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3292: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3293\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3293: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3294\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3294: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3295\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3295: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3296\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3296: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3297\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3297: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3298\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3298: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3299\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3299: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3300\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3300: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3301\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3301: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3302\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3302: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3303\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3303: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3304\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3304: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3305\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3305: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3306\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3306: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3307\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3307: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3308\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3308: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3309\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3309: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3310\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3310: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3311\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3311: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3312\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3312: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3313\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3313: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3314\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3314: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3315\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3315: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3316\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3316: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3317\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3317: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3318\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3318: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3319\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3319: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3320\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3320: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3321\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3321: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3322\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3322: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3323\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3323: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3324\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3324: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3325\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3325: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3326\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3326: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3327\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3327: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3328\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3328: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3329\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3329: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3330\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3330: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3331\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3331: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3332\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3332: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3333\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3333: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3334\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3334: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3335\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3335: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3336\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3336: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3337\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3337: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3338\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3338: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3339\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3339: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3340\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3340: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3341\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3341: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3342\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3342: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3343\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3343: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3344\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3344: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3345\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3345: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3346\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3346: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3347\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3347: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3348\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3348: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3349\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3349: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3350\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3350: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3351\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3351: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3352\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3352: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3353\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3353: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3354\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3354: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3355\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3355: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3356\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3356: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3357\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3357: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3358\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3358: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3359\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3359: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3360\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3360: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3361\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3361: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3362\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3362: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3363\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3363: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3364\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3364: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3365\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3365: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3366\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3366: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3367\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3367: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3368\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3368: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3369\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3369: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3370\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3370: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3371\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3371: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3372\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3372: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3373\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3373: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3374\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3374: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3375\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3375: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3376\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3376: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3377\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3377: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3378\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3378: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3379\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3379: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3380\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3380: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3381\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3381: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3382\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3382: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3383\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3383: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3384\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3384: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3385\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3385: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3386\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3386: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3387\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3387: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3388\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3388: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3389\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3389: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3390\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3390: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3391\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3391: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3392\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3392: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3393\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3393: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3394\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3394: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3395\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3395: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3396\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3396: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3397\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3397: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3398\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3398: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3399\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3399: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3400\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3400: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3401\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3401: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3402\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3402: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3403\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3403: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3404\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3404: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3405\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3405: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3406\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3406: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3407\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3407: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3408\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3408: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3409\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3409: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3410\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3410: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3411\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3411: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3412\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3412: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3413\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3413: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3414\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3414: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3415\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3415: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3416\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3416: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3417\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3417: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3418\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3418: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3419\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3419: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3420\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3420: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3421\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3421: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3422\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3422: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3423\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3423: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3424\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3424: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3425\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3425: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3426\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3426: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3427\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3427: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3428\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3428: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3429\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3429: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3430\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3430: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3431\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3431: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3432\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3432: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3433\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3433: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3434\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3434: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3435\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3435: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3436\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3436: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3437\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3437: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3438\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3438: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3439\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3439: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3440\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3440: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3441\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3441: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3442\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3442: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3443\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3443: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3444\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3444: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3445\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3445: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3446\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3446: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3447\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3447: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3448\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3448: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3449\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3449: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3450\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3450: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3451\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3451: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3452\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3452: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3453\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3453: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3454\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3454: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3455\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3455: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3456\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3456: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3457\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3457: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3458\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3458: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3459\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3459: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3460\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3460: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3461\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3461: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3462\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3462: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3463\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3463: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3464\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3464: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3465\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3465: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3466\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3466: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3467\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3467: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3468\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3468: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3469\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3469: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3470\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3470: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3471\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3471: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3472\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3472: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3473\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3473: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3474\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3474: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3475\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3475: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3476\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3476: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3477\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3477: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3478\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3478: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3479\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3479: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3480\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3480: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3481\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3481: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3482\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3482: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3483\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3483: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3484\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3484: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3485\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3485: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3486\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3486: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3487\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3487: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3488\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3488: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3489\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3489: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3490\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3490: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3491\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3491: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3492\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3492: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3493\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3493: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3494\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3494: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3495\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3495: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3496\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3496: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3497\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3497: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3498\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3498: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3499\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3499: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3500\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3500: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3501\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3501: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3502\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3502: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3503\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3503: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3504\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3504: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3505\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3505: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3506\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3506: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3507\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3507: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3508\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3508: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3509\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3509: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3510\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3510: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3511\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3511: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3512\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3512: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3513\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3513: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3514\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3514: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3515\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3515: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3516\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3516: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3517\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3517: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3518\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3518: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3519\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3519: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3520\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3520: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3521\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3521: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3522\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3522: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3523\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3523: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3524\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3524: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3525\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3525: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3526\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3526: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3527\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3527: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3528\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3528: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3529\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3529: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3530\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3530: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3531\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3531: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3532\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3532: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3533\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3533: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3534\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3534: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3535\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3535: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3536\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3536: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3537\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3537: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3538\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3538: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3539\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3539: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3540\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3540: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3541\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3541: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3542\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3542: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3543\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3543: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3544\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3544: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3545\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3545: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3546\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3546: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3547\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3547: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3548\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3548: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3549\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3549: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3550\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3550: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3551\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3551: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3552\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3552: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3553\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3553: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3554\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3554: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3555\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3555: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3556\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3556: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3557\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3557: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3558\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3558: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3559\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3559: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3560\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3560: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3561\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3561: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3562\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3562: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3563\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3563: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3564\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3564: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3565\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3565: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3566\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3566: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3567\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3567: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3568\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3568: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3569\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3569: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3570\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3570: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3571\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3571: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3572\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3572: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3573\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3573: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3574\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3574: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3575\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3575: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3576\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3576: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3577\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3577: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3578\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3578: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3579\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3579: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3580\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3580: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3581\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3581: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3582\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3582: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3583\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3583: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3584\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3584: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3585\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3585: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3586\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3586: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3587\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3587: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3588\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3588: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3589\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3589: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3590\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3590: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3591\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3591: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3592\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3592: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3593\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3593: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3594\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3594: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3595\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3595: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3596\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3596: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3597\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3597: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3598\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3598: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3599\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3599: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3600\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3600: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3601\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3601: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3602\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3602: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3603\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3603: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3604\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3604: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3605\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3605: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3606\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3606: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3607\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3607: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3608\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3608: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3609\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3609: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3610\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3610: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3611\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3611: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3612\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3612: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3613\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3613: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3614\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3614: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3615\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3615: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3616\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3616: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3617\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3617: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3618\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3618: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3619\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3619: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3620\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3620: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3621\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3621: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3622\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3622: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3623\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3623: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3624\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3624: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3625\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3625: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3626\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3626: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3627\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3627: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3628\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3628: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3629\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3629: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3630\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3630: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3631\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3631: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3632\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3632: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3633\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3633: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3634\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3634: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3635\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3635: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3636\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3636: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3637\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3637: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3638\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3638: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3639\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3639: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3640\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3640: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3641\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3641: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3642\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3642: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3643\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3643: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3644\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3644: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3645\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3645: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3646\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3646: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3647\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3647: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3648\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3648: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3649\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3649: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3650\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3650: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3651\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3651: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3652\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3652: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3653\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3653: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3654\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3654: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3655\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3655: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3656\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3656: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3657\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3657: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3658\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3658: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3659\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3659: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3660\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3660: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3661\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3661: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3662\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3662: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3663\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3663: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3664\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3664: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3665\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3665: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3666\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3666: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3667\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3667: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3668\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3668: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3669\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3669: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3670\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3670: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3671\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3671: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3672\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3672: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3673\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3673: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3674\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3674: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3675\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3675: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3676\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3676: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3677\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3677: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3678\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3678: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3679\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3679: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3680\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3680: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3681\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3681: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3682\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3682: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3683\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3683: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3684\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3684: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3685\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3685: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3686\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3686: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3687\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3687: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3688\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3688: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3689\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3689: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3690\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3690: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3691\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3691: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3692\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3692: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3693\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3693: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3694\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3694: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3695\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3695: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3696\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3696: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3697\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3697: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3698\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3698: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3699\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3699: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3700\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3700: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3701\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3701: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3702\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3702: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3703\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3703: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3704\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3704: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3705\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3705: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3706\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3706: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3707\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3707: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3708\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3708: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3709\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3709: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3710\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3710: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3711\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3711: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3712\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3712: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3713\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3713: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3714\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3714: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3715\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3715: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3716\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3716: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3717\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3717: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3718\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3718: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3719\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3719: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3720\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3720: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3721\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3721: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3722\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3722: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3723\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3723: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3724\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3724: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3725\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3725: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3726\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3726: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3727\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3727: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3728\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3728: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3729\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3729: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3730\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3730: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3731\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3731: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3732\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3732: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3733\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3733: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3734\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3734: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3735\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3735: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3736\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3736: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3737\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3737: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3738\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3738: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3739\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3739: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3740\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3740: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3741\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3741: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3742\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3742: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3743\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3743: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3744\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3744: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3745\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3745: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3746\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3746: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3747\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3747: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3748\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3748: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3749\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3749: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3750\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3750: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3751\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3751: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3752\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3752: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3753\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3753: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3754\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3754: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3755\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3755: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3756\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3756: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3757\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3757: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3758\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3758: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3759\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3759: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3760\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3760: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3761\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3761: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3762\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3762: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3763\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3763: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3764\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3764: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3765\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3765: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3766\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3766: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3767\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3767: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3768\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3768: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3769\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3769: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3770\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3770: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3771\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3771: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3772\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3772: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3773\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3773: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3774\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3774: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3775\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3775: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3776\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3776: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3777\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3777: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3778\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3778: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3779\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3779: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3780\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3780: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3781\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3781: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3782\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3782: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3783\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3783: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3784\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3784: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3785\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3785: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3786\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3786: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3787\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3787: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3788\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3788: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3789\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3789: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3790\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3790: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3791\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3791: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3792\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3792: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3793\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3793: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3794\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3794: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3795\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3795: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3796\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3796: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3797\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3797: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3798\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3798: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3799\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3799: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3800\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3800: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3801\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3801: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3802\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3802: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3803\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3803: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3804\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3804: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3805\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3805: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3806\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3806: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3807\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3807: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3808\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3808: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3809\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3809: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3810\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3810: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3811\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3811: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3812\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3812: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3813\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3813: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3814\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3814: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3815\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3815: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3816\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3816: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3817\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3817: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3818\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3818: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3819\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3819: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3820\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3820: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3821\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3821: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3822\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3822: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3823\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3823: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3824\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3824: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3825\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3825: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3826\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3826: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3827\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3827: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3828\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3828: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3829\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3829: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3830\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3830: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3831\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3831: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3832\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3832: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3833\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3833: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3834\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3834: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3835\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3835: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3836\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3836: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3837\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3837: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3838\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3838: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3839\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3839: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3840\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3840: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3841\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3841: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3842\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3842: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3843\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3843: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3844\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3844: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3845\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3845: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3846\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3846: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3847\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3847: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3848\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3848: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3849\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3849: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3850\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3850: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3851\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3851: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3852\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3852: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3853\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3853: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3854\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3854: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3855\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3855: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3856\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3856: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3857\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3857: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3858\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3858: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3859\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3859: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3860\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3860: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3861\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3861: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3862\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3862: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3863\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3863: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3864\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3864: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3865\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3865: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3866\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3866: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3867\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3867: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3868\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3868: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3869\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3869: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3870\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3870: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3871\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3871: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3872\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3872: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3873\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3873: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3874\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3874: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3875\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3875: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3876\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3876: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3877\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3877: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3878\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3878: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3879\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3879: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3880\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3880: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3881\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3881: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3882\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3882: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3883\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3883: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3884\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3884: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3885\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3885: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3886\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3886: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3887\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3887: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3888\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3888: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3889\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3889: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3890\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3890: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3891\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3891: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3892\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3892: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3893\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3893: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3894\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3894: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3895\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3895: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3896\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3896: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3897\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3897: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3898\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3898: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3899\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3899: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3900\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3900: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3901\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3901: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3902\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3902: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3903\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3903: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3904\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3904: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3905\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3905: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3906\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3906: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3907\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3907: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3908\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3908: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3909\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3909: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3910\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3910: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3911\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3911: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3912\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3912: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3913\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3913: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3914\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3914: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3915\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3915: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3916\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3916: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3917\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3917: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3918\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3918: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3919\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3919: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3920\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3920: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3921\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3921: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3922\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3922: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3923\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3923: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3924\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3924: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3925\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3925: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3926\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3926: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3927\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3927: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3928\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3928: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3929\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3929: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3930\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3930: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3931\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3931: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3932\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3932: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3933\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3933: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3934\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3934: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3935\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3935: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3936\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3936: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3937\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3937: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3938\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3938: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3939\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3939: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3940\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3940: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3941\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3941: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3942\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3942: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3943\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3943: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3944\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3944: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3945\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3945: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3946\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3946: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3947\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3947: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3948\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3948: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3949\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3949: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3950\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3950: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3951\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3951: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3952\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3952: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3953\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3953: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3954\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3954: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3955\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3955: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3956\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3956: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3957\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3957: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3958\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3958: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3959\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3959: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3960\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3960: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3961\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3961: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3962\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3962: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3963\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3963: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3964\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3964: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3965\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3965: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3966\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3966: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3967\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3967: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3968\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3968: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3969\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3969: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3970\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3970: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3971\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3971: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3972\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3972: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3973\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3973: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3974\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3974: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3975\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3975: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3976\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3976: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3977\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3977: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3978\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3978: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3979\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3979: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3980\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3980: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3981\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3981: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3982\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3982: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3983\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3983: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3984\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3984: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3985\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3985: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3986\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3986: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3987\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3987: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3988\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3988: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3989\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3989: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3990\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3990: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3991\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3991: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3992\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3992: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3993\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3993: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3994\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3994: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3995\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3995: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3996\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3996: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3997\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3997: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3998\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3998: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l3999\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l3999: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4000\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4000: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4001\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4001: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4002\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4002: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4003\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4003: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4004\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4004: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4005\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4005: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4006\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4006: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4007\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4007: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4008\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4008: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4009\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4009: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4010\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4010: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4011\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4011: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4012\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4012: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4013\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4013: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4014\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4014: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4015\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4015: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4016\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4016: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4017\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4017: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4018\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4018: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4019\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4019: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4020\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4020: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4021\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4021: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4022\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4022: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4023\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4023: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4024\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4024: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4025\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4025: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4026\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4026: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4027\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4027: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4028\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4028: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4029\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4029: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4030\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4030: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4031\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4031: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4032\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4032: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4033\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4033: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4034\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4034: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4035\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4035: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4036\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4036: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4037\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4037: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4038\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4038: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4039\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4039: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4040\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4040: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4041\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4041: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4042\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4042: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4043\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4043: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4044\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4044: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4045\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4045: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4046\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4046: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4047\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4047: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4048\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4048: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4049\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4049: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4050\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4050: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4051\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4051: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4052\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4052: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4053\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4053: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4054\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4054: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4055\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4055: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4056\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4056: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4057\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4057: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4058\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4058: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4059\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4059: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4060\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4060: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4061\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4061: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4062\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4062: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4063\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4063: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4064\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4064: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4065\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4065: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4066\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4066: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4067\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4067: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4068\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4068: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4069\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4069: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4070\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4070: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4071\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4071: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4072\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4072: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4073\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4073: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4074\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4074: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4075\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4075: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4076\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4076: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4077\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4077: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4078\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4078: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4079\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4079: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4080\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4080: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4081\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4081: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4082\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4082: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4083\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4083: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4084\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4084: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4085\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4085: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4086\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4086: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4087\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4087: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4088\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4088: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4089\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4089: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4090\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4090: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4091\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4091: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4092\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4092: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4093\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4093: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"ble l4094\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"nop\n\t"
-"l4094: \n\t"
-"mov w0, #10\n\t"
-"cmp w0, #15\n\t"
-"nop\n\t"
-);
-}
-end = clock();
-printf("CPU time used: %ld\n", end - start);
-return 0;
-}
@@ -1,191 +1,281 @@
-#define _GNU_SOURCE
-
-#include <err.h>
-#include <fcntl.h>
-#include <gelf.h>
-#include <libelf.h>
-#include <sched.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
-#include <string.h>
-#include <sys/mman.h>
-#include <time.h>
 #include <unistd.h>
 
-#define TRIALS 10000
+#include "bpure.h"
+#include "measure.h"
+#include "perturb.h"
+#include "refine.h"
+#include "sink.h"
+#include "store.h"
+#include "timer.h"
+#include "trials.h"
+#include "workers.h"
+
 #define TARGET_ADDRESS 0x10000000   // mmap needs the address to be aligned to a page boundary
-#define MAX_INDEX_BITS 26
-#define MAX_FUNC_PTR_NUM 20
+#define MAX_INDEX_BITS 26       // Default spacing of the copies, log2 bytes
+#define MAX_FUNC_PTR_NUM 64
+#define MAX_RANGE_LEN 64
+#define DEFAULT_BRANCH_NUMS "2..20"
 void (*perform_branch[MAX_FUNC_PTR_NUM])();
+struct timer timer;
+struct code_arena arena; // Holds the copies of perform_branch
+struct trials tc;
+struct perturb perturb;
+const char *timer_name = "auto";
+const char *perturb_mode = "sw";
+int branch_nums[MAX_RANGE_LEN];
+struct sink sink;
+struct store store;
+struct refine refine;
+int col_branch_num, col_cpu, col_trials, col_mean, col_ci, col_net;
+int worker_cpu;
 
-void load_function(const char *filename, const char *func_name, int index_bits)
+uint64_t measure_window(int branch_num)
 {
-    if (elf_version(EV_CURRENT) == EV_NONE)
-    {
-        fprintf(stderr, "ELF library initialization failed: %s\n", elf_errmsg(-1));
-        exit(EXIT_FAILURE);
-    }
+    uint64_t start_time, end_time;
 
-    int fd = open(filename, O_RDONLY);
-    if (fd < 0)
-    {
-        perror("open");
-        exit(EXIT_FAILURE);
-    }
+    start_time = timer_read(&timer);
+    #pragma GCC unroll 64
+    for (int j = 0; j < branch_num; j++)
+        perform_branch[j]();
+    end_time = timer_read(&timer);
+
+    return end_time - start_time;
+}
+
+uint64_t measure_empty(void *ctx)
+{
+    return measure_window(*(int *)ctx);
+}
 
-    Elf *e = elf_begin(fd, ELF_C_READ, NULL);
-    if (!e)
+// Average time per branch with the overhead of a window of branch_num empty calls removed. Windows
+// are timed until their mean is known to the target relative error; *trials is how many that took
+// and *ci the confidence half-width of the average.
+double measure_branch_time(int branch_num, double *net, double *ci, long *trials)
+{
+    struct welford w;
+    void (*saved[MAX_FUNC_PTR_NUM])();
+    struct overhead overhead;
+
+    for (int j = 0; j < branch_num; j++)
     {
-        fprintf(stderr, "elf_begin() failed: %s\n", elf_errmsg(-1));
-        close(fd);
-        exit(EXIT_FAILURE);
+        saved[j] = perform_branch[j];
+        perform_branch[j] = (void (*)())empty_gadget();
     }
+    overhead_calibrate(&overhead, measure_empty, &branch_num, OVERHEAD_SAMPLES);
+    for (int j = 0; j < branch_num; j++)
+        perform_branch[j] = saved[j];
 
-    Elf_Scn *scn = NULL;
-    GElf_Shdr shdr;
-    while ((scn = elf_nextscn(e, scn)) != NULL)
+    long attempts = 0;
+    welford_init(&w);
+    while (!trials_done(&tc, &w) && !perturb_give_up(&perturb, &attempts, trials_max_attempts(&tc)))
     {
-        gelf_getshdr(scn, &shdr);
-        if (shdr.sh_type == SHT_SYMTAB)
-        {
-            Elf_Data *data = elf_getdata(scn, NULL);
-            int count = shdr.sh_size / shdr.sh_entsize;
-            for (int i = 0; i < count; ++i)
-            {
-                GElf_Sym sym;
-                gelf_getsym(data, i, &sym);
-                if (strcmp(func_name, elf_strptr(e, shdr.sh_link, sym.st_name)) == 0)
-                {
-                    // printf("Symbol name: %s\n", func_name);
-                    printf("Symbol size: %zu\n", sym.st_size);
-                    if (sym.st_size >= (1 << index_bits))
-                    {
-                        fprintf(stderr, "Function size is too large for the given index bits\n");
-                        elf_end(e);
-                        close(fd);
-                        exit(EXIT_FAILURE);
-                    }
-
-                    // Find the section containing the symbol
-                    Elf_Scn *sym_scn = elf_getscn(e, sym.st_shndx);
-                    GElf_Shdr sym_shdr;
-                    gelf_getshdr(sym_scn, &sym_shdr);
-
-                    // Calculate the file offset of the symbol
-                    off_t offset = sym_shdr.sh_offset + (sym.st_value - sym_shdr.sh_addr);
-                    // printf("Symbol offset: %ld\n", offset);
-
-                    // Calculate the memory we need to put all the functions
-                    size_t size = (1 << index_bits) * MAX_FUNC_PTR_NUM;
-                    size = (size + 0xfff) & ~0xfff; // Align to page size
-                    void *mem = mmap((void *)TARGET_ADDRESS, size, PROT_READ | PROT_WRITE | PROT_EXEC,
-                                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
-                    if (mem == MAP_FAILED)
-                    {
-                        perror("mmap");
-                        elf_end(e);
-                        close(fd);
-                        exit(EXIT_FAILURE);
-                    }
-                    memset(mem, 0, size);
-
-                    lseek(fd, offset, SEEK_SET);
-                    ssize_t bytes_read = read(fd, mem, sym.st_size);
-                    if (bytes_read != sym.st_size)
-                    {
-                        fprintf(stderr, "Failed to read function code: expected %zu bytes, got %zd bytes\n", sym.st_size, bytes_read);
-                        elf_end(e);
-                        close(fd);
-                        exit(EXIT_FAILURE);
-                    }
-
-                    // /*
-                    printf("Read content:\n");
-                    for (ssize_t j = 0; j < bytes_read; ++j)
-                    {
-                        printf("%02x ", ((unsigned char *)mem)[j]);
-                    }
-                    printf("\n");
-                    // */
-
-                    perform_branch[0] = (void (*)())mem;
-                    // Clear instruction cache
-                    __builtin___clear_cache(mem, (char *)mem + sym.st_size);
-
-                    for (int j = 1; j < MAX_FUNC_PTR_NUM; j++)
-                    {
-                        memcpy((char *)mem + j * (1 << index_bits), mem, sym.st_size);
-                        perform_branch[j] = (void (*)())((char *)mem + j * (1 << index_bits));
-                        // Clear instruction cache
-                        __builtin___clear_cache((char *)mem + j * (1 << index_bits), (char *)mem + j * (1 << index_bits) + sym.st_size);
-                    }
-
-                    break;
-                }
-            }
-            break;
-        }
+        struct perturb_counts perturbation;
+
+        perturb_begin(&perturb, &perturbation);
+        uint64_t window = measure_window(branch_num);
+        if (!perturb_end(&perturb, &perturbation))
+            welford_add(&w, window);
     }
 
-    elf_end(e);
-    close(fd);
+    *trials = w.n;
+    *ci = welford_ci(&w) / branch_num;
+    *net = overhead_net(&overhead, w.mean) / branch_num;
+    return w.mean / branch_num;
 }
 
-// Function to bind the process to a specific CPU
-void bind_to_cpu(int cpu)
+// Per worker: everything that depends on the core it runs on
+void setup(int cpu, void *ctx)
 {
-    cpu_set_t set;
-    CPU_ZERO(&set);
-    CPU_SET(cpu, &set);
-    if (sched_setaffinity(0, sizeof(set), &set) < 0)
-        err(EXIT_FAILURE, "Unable to set CPU affinity");
-}
+    worker_cpu = cpu;
 
-// Function to get current time; similar to rdtscp
-__attribute__((always_inline)) inline uint64_t read_cntvct(void)
-{
-    uint64_t val;
-    asm volatile("dsb ish" ::: "memory");
-    asm volatile("mrs %0, cntvct_el0" : "=r"(val)); // Barrier before and after reading the counter
-    asm volatile("dsb ish" ::: "memory");
-    return val;
+    // Drop trials that a context switch, migration, page fault or interrupt landed in
+    perturb_open(&perturb, perturb_mode, cpu);
+
+    // Calibrate the timer on the CPU it will be read on
+    timer_open_named(&timer, timer_name);
+    timer_report(&timer, stdout);
 }
 
-double measure_branch_time(int iterations, int branch_num)
+void run_point(int point, void *ctx)
 {
-    uint64_t start_time, end_time, total_time = 0;
+    double avg_time, net_time, ci;
+    long trials;
+    int branch_num = branch_nums[point];
 
-    for (int i = 0; i < iterations; i++)
+    if (store_lookup(&store, &sink, "branch_num=%d", branch_num))
     {
-        start_time = read_cntvct();
-        #pragma GCC unroll 64
-        for (int j = 0; j < branch_num; j++)
-            perform_branch[j]();
-        end_time = read_cntvct();
-        total_time += end_time - start_time;
+        refine_record(&refine, point, sink.row[col_mean].f, sink.row[col_ci].f);
+        return;
     }
 
-    return 1.0 * total_time / (iterations * branch_num);
+    // Measure the time taken for branches
+    avg_time = measure_branch_time(branch_num, &net_time, &ci, &trials);
+    store_printf(&store,
+                 "Number of branches: %d, Average time for each branch: %lf, Net time for each branch: %lf, "
+                 "Trials: %ld\n",
+                 branch_num, avg_time, net_time, trials);
+
+    sink_int(&sink, col_branch_num, branch_num);
+    sink_int(&sink, col_cpu, worker_cpu);
+    sink_int(&sink, col_trials, trials);
+    sink_float(&sink, col_mean, avg_time);
+    sink_float(&sink, col_ci, ci);
+    sink_float(&sink, col_net, net_time);
+    refine_record(&refine, point, avg_time, ci);
+    store_commit(&store, &sink);
 }
 
-int main()
+void teardown(void *ctx)
 {
-    double avg_time;
-    int branch_num = 2;
+    timer_close(&timer);
+    perturb_report(&perturb, stdout);
+    perturb_close(&perturb);
+    store_report(&store, stdout);
+    sink_flush(&sink);
+}
 
-    // Bind the process to CPU 0
-    bind_to_cpu(0);
+int main(int argc, char **argv)
+{
+    struct sweep sweep;
+    uintptr_t target_address = TARGET_ADDRESS;
+    int num_branch_nums = parse_range(DEFAULT_BRANCH_NUMS, branch_nums, MAX_RANGE_LEN);
+    int stride_bits = MAX_INDEX_BITS;
+    int max_branch_num = 0;
+    const char *results_path = NULL, *results_format = NULL;
+    const char *store_dir = NULL;
+    int force = 0;
+    double threshold = 0;
+    const char *cpus = NULL;
+    int reserve = 0;
+    long max_trials = TRIALS_MAX;
+    double rel_err = TRIALS_REL_ERR;
+    int cpu = 0;
+    int opt;
 
-    // Load the function containing the branch instruction
-    load_function("branch.o", "perform_branch", MAX_INDEX_BITS);
+    while ((opt = getopt(argc, argv, "a:b:s:c:j:kt:n:e:P:o:f:R:FA:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'a':
+            target_address = strtoull(optarg, NULL, 0);
+            break;
+        case 'b':
+            num_branch_nums = parse_range(optarg, branch_nums, MAX_RANGE_LEN);
+            break;
+        case 's':
+            stride_bits = atoi(optarg);
+            break;
+        case 'c':
+            cpu = atoi(optarg);
+            break;
+        case 'j':
+            cpus = optarg;
+            break;
+        case 'k':
+            reserve = 1;
+            break;
+        case 't':
+            timer_name = optarg;
+            break;
+        case 'n':
+            max_trials = atol(optarg);
+            break;
+        case 'e':
+            rel_err = atof(optarg);
+            break;
+        case 'P':
+            perturb_mode = optarg;
+            break;
+        case 'o':
+            results_path = optarg;
+            break;
+        case 'f':
+            results_format = optarg;
+            break;
+        case 'R':
+            store_dir = optarg;
+            break;
+        case 'F':
+            force = 1;
+            break;
+        case 'A':
+            threshold = atof(optarg);
+            break;
+        default:
+            fprintf(stderr,
+                    "Usage: %s [-a address] [-b branch_nums] [-s stride_bits] [-c cpu | -j cpus|all [-k]] [-t timer] "
+                    "[-n max_trials] [-e rel_err] [-P none|sw|irq|all] [-o results [-f csv|jsonl|bin]] "
+                    "[-R store [-F]] [-A threshold]\n",
+                    argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
 
-    for (; branch_num <= MAX_FUNC_PTR_NUM; branch_num++)
+    for (int i = 0; i < num_branch_nums; i++)
     {
-        // Measure the time taken for branches
-        avg_time = measure_branch_time(TRIALS, branch_num);
-        printf("Number of branches: %d, Average time for each branch: %lf\n", branch_num, avg_time);
+        if (branch_nums[i] < 1 || branch_nums[i] > MAX_FUNC_PTR_NUM)
+        {
+            fprintf(stderr, "Number of branches must be between 1 and %d: %d\n", MAX_FUNC_PTR_NUM, branch_nums[i]);
+            return EXIT_FAILURE;
+        }
+        if (branch_nums[i] > max_branch_num)
+            max_branch_num = branch_nums[i];
+    }
+    if (stride_bits < 0 || stride_bits > 40)
+    {
+        fprintf(stderr, "Stride must be between 0 and 40 bits: %d\n", stride_bits);
+        return EXIT_FAILURE;
     }
 
+    // One worker per CPU, pinned; -k leaves the lowest CPU to the OS
+    sweep_parse(&sweep, cpus, reserve, cpu);
+    trials_init(&tc, max_trials, rel_err);
+
+    // Load the function containing the branch instruction; workers inherit the copies
+    bpure_verbose = 1;
+    load_function(&arena, "branch.o", "perform_branch", target_address, (size_t)1 << stride_bits,
+                  max_branch_num, (void **)perform_branch);
+
+    // One record per sweep point, written by whichever worker measured it
+    sink_open(&sink, results_path, results_format);
+    col_branch_num = sink_column(&sink, "branch_num", SINK_INT);
+    col_cpu = sink_column(&sink, "cpu", SINK_INT);
+    col_trials = sink_column(&sink, "trials", SINK_INT);
+    col_mean = sink_column(&sink, "ticks_per_branch", SINK_FLOAT);
+    col_ci = sink_column(&sink, "ticks_per_branch_ci", SINK_FLOAT);
+    col_net = sink_column(&sink, "net_ticks_per_branch", SINK_FLOAT);
+    sink_meta_system(&sink, sweep.cpus[0], argc, argv);
+    sink_meta(&sink, "experiment", "btb_ways");
+    if (results_path || store_dir)
+    {
+        // Workers calibrate their own timers; resolve the name here so the record says which one ran
+        struct timer probe;
+        timer_open_named(&probe, timer_name);
+        sink_meta(&sink, "timer", "%s", probe.name);
+        timer_close(&probe);
+    }
+    sink_meta(&sink, "stride_bits", "%d", stride_bits);
+    sink_meta(&sink, "address", "%#lx", (unsigned long)target_address);
+    sink_meta(&sink, "max_trials", "%ld", max_trials);
+    sink_meta(&sink, "rel_err", "%g", rel_err);
+    sink_meta(&sink, "perturb", "%s", perturb_mode);
+    sink_start(&sink);
+
+    // Points already in the store are replayed instead of measured, unless -F
+    store_open(&store, store_dir, force, &sink);
+
+    // Coarse pass first, then bisection wherever neighbouring points differ by more than -A
+    refine_init(&refine, threshold);
+    refine_axis(&refine, "branch_num", branch_nums, num_branch_nums);
+    refine_run(&refine, &sweep, setup, run_point, teardown, NULL);
+    refine_report(&refine, stdout);
+    refine_free(&refine);
+
+    sink_close(&sink);
+    arena_release(&arena);
+
     return 0;
-}
\ No newline at end of file
+}
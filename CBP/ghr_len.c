@@ -1,119 +1,49 @@
-#define _GNU_SOURCE
-
-#include <err.h>
-#include <fcntl.h>
-#include <gelf.h>
-#include <libelf.h>
-#include <sched.h>
 #include <stdio.h>
+#include <math.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/mman.h>
 #include <time.h>
 #include <unistd.h>
 
-#define TRIALS 10000
+#include "bpure.h"
+#include "hist.h"
+#include "measure.h"
+#include "perturb.h"
+#include "pmu.h"
+#include "sink.h"
+#include "timer.h"
+#include "trials.h"
+
+#define MAX_RANGE_LEN 256
+#define DEFAULT_DUMMIES "0..49"
+#define MAX_BATCH 1024
 
 #define TARGET_ADDRESS 0x10000000                           // mmap needs the address to be aligned to a page boundary
 #define BEQ_OFFSET 0x10                                     // Offset of the branch instruction in the binary
 #define TARGET_BRANCH_ADDRESS (TARGET_ADDRESS + BEQ_OFFSET) // Address of the branch instruction
 
-void (*perform_branch)(int);
+// Branches run_pmu executes between the train and the test branch besides the dummies, as compiled at the
+// Makefile's -O0: perform_branch's ret, the jump to the loop condition, the loop's exit and the blr back
+// into perform_branch. The counter reads have none. Each dummy adds the loop branch, bl, b and ret.
+#define FIXED_BRANCHES 4
+#define FIXED_CONDITIONAL_BRANCHES 1
 
-void load_function(const char *filename, const char *func_name)
-{
-    if (elf_version(EV_CURRENT) == EV_NONE)
-    {
-        fprintf(stderr, "ELF library initialization failed: %s\n", elf_errmsg(-1));
-        exit(EXIT_FAILURE);
-    }
-
-    int fd = open(filename, O_RDONLY);
-    if (fd < 0)
-    {
-        perror("open");
-        exit(EXIT_FAILURE);
-    }
-
-    Elf *e = elf_begin(fd, ELF_C_READ, NULL);
-    if (!e)
-    {
-        fprintf(stderr, "elf_begin() failed: %s\n", elf_errmsg(-1));
-        close(fd);
-        exit(EXIT_FAILURE);
-    }
-
-    Elf_Scn *scn = NULL;
-    GElf_Shdr shdr;
-    while ((scn = elf_nextscn(e, scn)) != NULL)
-    {
-        gelf_getshdr(scn, &shdr);
-        if (shdr.sh_type == SHT_SYMTAB)
-        {
-            Elf_Data *data = elf_getdata(scn, NULL);
-            int count = shdr.sh_size / shdr.sh_entsize;
-            for (int i = 0; i < count; ++i)
-            {
-                GElf_Sym sym;
-                gelf_getsym(data, i, &sym);
-                if (strcmp(func_name, elf_strptr(e, shdr.sh_link, sym.st_name)) == 0)
-                {
-                    printf("Symbol name: %s\n", func_name);
-                    printf("Symbol size: %zu\n", sym.st_size);
-
-                    // Find the section containing the symbol
-                    Elf_Scn *sym_scn = elf_getscn(e, sym.st_shndx);
-                    GElf_Shdr sym_shdr;
-                    gelf_getshdr(sym_scn, &sym_shdr);
-
-                    // Calculate the file offset of the symbol
-                    off_t offset = sym_shdr.sh_offset + (sym.st_value - sym_shdr.sh_addr);
-                    printf("Symbol offset: %ld\n", offset);
-
-                    // Ensure memory alignment
-                    size_t aligned_size = (sym.st_size + 3) & ~3;
-                    void *mem = mmap((void *)TARGET_ADDRESS, aligned_size, PROT_READ | PROT_WRITE | PROT_EXEC,
-                                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
-                    if (mem == MAP_FAILED)
-                    {
-                        perror("mmap");
-                        elf_end(e);
-                        close(fd);
-                        exit(EXIT_FAILURE);
-                    }
-
-                    lseek(fd, offset, SEEK_SET);
-                    ssize_t bytes_read = read(fd, mem, sym.st_size);
-                    if (bytes_read != sym.st_size)
-                    {
-                        fprintf(stderr, "Failed to read function code: expected %zu bytes, got %zd bytes\n", sym.st_size, bytes_read);
-                        elf_end(e);
-                        close(fd);
-                        exit(EXIT_FAILURE);
-                    }
-
-                    printf("Read content:\n");
-                    for (ssize_t j = 0; j < bytes_read; ++j)
-                    {
-                        printf("%02x ", ((unsigned char *)mem)[j]);
-                    }
-                    printf("\n");
-
-                    // Clear instruction cache
-                    __builtin___clear_cache(mem, (char *)mem + sym.st_size);
-
-                    perform_branch = (void (*)(int))mem;
-                    break;
-                }
-            }
-            break;
-        }
-    }
-
-    elf_end(e);
-    close(fd);
-}
+void (*perform_branch)(int);
+void (*train_branch)(int); // perform_branch, or the empty gadget while calibrating
+void (*test_branch)(int);
+struct timer timer;
+struct pmu pmu;
+struct code_arena arena; // Holds perform_branch
+struct perturb perturb;
+int use_pmu = 0; // Count mispredicts instead of inferring them from latency
+int batch = 1;   // Trials in one timed window
+int dummies = 0; // Dummy branches between the train and the test branch
+int conds[MAX_BATCH];
+struct trials tc;
+struct hist windows; // Full windows of the current dummy count
+struct sink sink;
+int col_dummies, col_trials, col_train, col_test, col_test_ci, col_test_median;
 
 // Function containing the unconditional branch instruction
 void dummy_branch()
@@ -127,128 +57,277 @@ void dummy_branch()
         : "cc", "memory");
 }
 
-// Function to bind the process to a specific CPU
-void bind_to_cpu(int cpu)
+// Time `batch` back-to-back trials of train branch, dummy branches, test branch. Replicating single
+// branches would let the test branch train itself, so whole trials are batched and the cost of each
+// branch is recovered by swapping it for the empty gadget.
+uint64_t measure_trials(void *ctx)
 {
-    cpu_set_t set;
-    CPU_ZERO(&set);
-    CPU_SET(cpu, &set);
-    if (sched_setaffinity(0, sizeof(set), &set) < 0)
-        err(EXIT_FAILURE, "Unable to set CPU affinity");
-}
+    uint64_t start_time, end_time;
 
-// Function to get current time; similar to rdtscp
-__attribute__((always_inline)) inline uint64_t read_cntvct(void)
-{
-    uint64_t val;
-    asm volatile("dsb ish" ::: "memory");
-    asm volatile("mrs %0, cntvct_el0" : "=r"(val)); // Barrier before and after reading the counter
-    asm volatile("dsb ish" ::: "memory");
-    return val;
-}
+    for (int r = 0; r < batch; r++)
+        conds[r] = (int)xrand() % 2;
 
-//////////////////////////////////////////////
-// xorshift128+ by Sebastiano Vigna
-// from http://xorshift.di.unimi.it/xorshift128plus.c
-uint64_t s[2] = {0, 1};
+    start_time = timer_read(&timer);
+    for (int r = 0; r < batch; r++)
+    {
+        train_branch(conds[r]);
+        for (int j = 0; j < dummies; j++)
+            dummy_branch();
+        test_branch(conds[r]);
+    }
+    end_time = timer_read(&timer);
 
-__attribute__((always_inline)) inline uint64_t xrand(void)
-{
-    uint64_t s1 = s[0];
-    const uint64_t s0 = s[1];
-    s[0] = s0;
-    s1 ^= s1 << 23;                          // a
-    s[1] = s1 ^ s0 ^ (s1 >> 18) ^ (s0 >> 5); // b, c
-    return s[1] + s0;
+    return end_time - start_time;
 }
 
-// splitmix64 generator -- http://xorshift.di.unimi.it/splitmix64.c
-void xsrand(uint64_t x)
+void run_pmu(void)
 {
-    for (int i = 0; i <= 1; i++)
+    struct welford train, test;
+    struct perturb_counts perturbation;
+
+    long attempts = 0;
+
+    welford_init(&train);
+    welford_init(&test);
+
+    while (!trials_done_pair(&tc, &train, &test) && !perturb_give_up(&perturb, &attempts, trials_max_attempts(&tc)))
     {
-        uint64_t z = (x += UINT64_C(0x9E3779B97F4A7C15));
-        z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
-        z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
-        s[i] = z ^ (z >> 31);
+        int rand = (int)xrand() % 2;
+        uint64_t count[4];
+
+        perturb_begin(&perturb, &perturbation);
+
+        // train branch, dummies, test branch; the counts are only subtracted once the test branch is done
+        count[0] = pmu_read_misses(&pmu);
+        perform_branch(rand);
+        count[1] = pmu_read_misses(&pmu);
+
+        for (int j = 0; j < dummies; j++)
+            dummy_branch();
+
+        count[2] = pmu_read_misses(&pmu);
+        perform_branch(rand);
+        count[3] = pmu_read_misses(&pmu);
+
+        if (perturb_end(&perturb, &perturbation))
+            continue;
+        welford_add(&train, count[1] - count[0]);
+        welford_add(&test, count[3] - count[2]);
     }
+
+    printf("Average mispredicts for train branch: %f\n", train.mean);
+    printf("Average mispredicts for test branch: %f (%ld trials)\n", test.mean, test.n);
+
+    sink_int(&sink, col_dummies, dummies);
+    sink_int(&sink, col_trials, test.n);
+    sink_float(&sink, col_train, train.mean);
+    sink_float(&sink, col_test, test.mean);
+    sink_float(&sink, col_test_ci, welford_ci(&test));
+    sink_float(&sink, col_test_median, NAN);
+    sink_emit(&sink);
 }
-/////////////////////////////////////
 
-int main()
+void run_timed(void)
 {
-    uint64_t start_time, end_time;
-    int rand;
+    struct welford full;
+    struct overhead no_test, neither;
 
-    // Load the function containing the branch instruction
-    load_function("branch.o", "perform_branch");
-    if (perform_branch)
-        printf("perform_branch is loaded to %p\n", perform_branch);
-    else
+    // Same windows with the test branch, then both branches, replaced by the empty gadget
+    test_branch = (void (*)(int))empty_gadget();
+    overhead_calibrate(&no_test, measure_trials, NULL, OVERHEAD_SAMPLES);
+    train_branch = test_branch;
+    overhead_calibrate(&neither, measure_trials, NULL, OVERHEAD_SAMPLES);
+    train_branch = test_branch = perform_branch;
+
+    long attempts = 0;
+
+    welford_init(&full);
+    hist_init(&windows);
+    while (!trials_done(&tc, &full) && !perturb_give_up(&perturb, &attempts, trials_max_attempts(&tc)))
     {
-        fprintf(stderr, "Failed to load function\n");
-        return EXIT_FAILURE;
-    }
+        struct perturb_counts perturbation;
 
-    // Bind the process to CPU 0
-    bind_to_cpu(0);
+        perturb_begin(&perturb, &perturbation);
+        uint64_t window = measure_trials(NULL);
+        if (perturb_end(&perturb, &perturbation))
+            continue;
 
-    // Random # generator
-    xsrand(time(NULL));
+        welford_add(&full, window);
+        hist_record(&windows, window);
+    }
 
-    for (int k = 0; k < 50; k++)
-    {
-        int results[TRIALS][2] = {0};
-        int total_branch_time[2] = {0};
+    double train_time = (no_test.median - neither.median) / batch;
+    double test_time = (full.mean - no_test.median) / batch;
+    double test_median = (hist_percentile(&windows, 50) - no_test.median) / batch;
 
+    printf("Average time for train branch: %f\n", train_time);
+    printf("Average time for test branch: %f, median %f (%ld trials)\n", test_time, test_median, full.n);
 
-        for (int iteration = 0; iteration < TRIALS; iteration++)
-        {
-            rand = (int)xrand() % 2;
-
-            // train branch
-            start_time = read_cntvct();
-            perform_branch(rand);
-            end_time = read_cntvct();
-            results[iteration][0] = (int)(end_time - start_time);
-
-            for (int j = 0; j < k; j++)
-                dummy_branch();
-
-            // test branch
-            start_time = read_cntvct();
-            perform_branch(rand);
-            end_time = read_cntvct();
-            results[iteration][1] = (int)(end_time - start_time);
-        }
+    sink_int(&sink, col_dummies, dummies);
+    sink_int(&sink, col_trials, full.n);
+    sink_float(&sink, col_train, train_time);
+    sink_float(&sink, col_test, test_time);
+    sink_float(&sink, col_test_ci, welford_ci(&full) / batch);
+    sink_float(&sink, col_test_median, test_median);
+    sink_emit(&sink);
+}
 
-        for (int i = 0; i < TRIALS; i++)
+int main(int argc, char **argv)
+{
+    uintptr_t target_address = TARGET_ADDRESS;
+    int dummy_counts[MAX_RANGE_LEN];
+    int num_dummies = parse_range(DEFAULT_DUMMIES, dummy_counts, MAX_RANGE_LEN);
+    void *entry;
+    const char *timer_name = "auto";
+    double batch_target = BATCH_TARGET_TICKS;
+    long max_trials = TRIALS_MAX;
+    double rel_err = TRIALS_REL_ERR;
+    const char *perturb_mode = "sw";
+    uint64_t seed = time(NULL);
+    const char *results_path = NULL, *results_format = NULL;
+    int cpu = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "a:c:d:t:m:B:n:e:P:S:o:f:")) != -1)
+    {
+        switch (opt)
         {
-            total_branch_time[0] += results[i][0];
-            total_branch_time[1] += results[i][1];
+        case 'a':
+            target_address = strtoull(optarg, NULL, 0);
+            break;
+        case 'c':
+            cpu = atoi(optarg);
+            break;
+        case 'd':
+            num_dummies = parse_range(optarg, dummy_counts, MAX_RANGE_LEN);
+            break;
+        case 't':
+            timer_name = optarg;
+            break;
+        case 'm':
+            use_pmu = strcmp(optarg, "pmu") == 0;
+            break;
+        case 'B':
+            batch_target = atof(optarg);
+            break;
+        case 'n':
+            max_trials = atol(optarg);
+            break;
+        case 'e':
+            rel_err = atof(optarg);
+            break;
+        case 'P':
+            perturb_mode = optarg;
+            break;
+        case 'S':
+            seed = strtoull(optarg, NULL, 0);
+            break;
+        case 'o':
+            results_path = optarg;
+            break;
+        case 'f':
+            results_format = optarg;
+            break;
+        default:
+            fprintf(stderr,
+                    "Usage: %s [-a address] [-c cpu] [-d dummies] [-t timer] [-m time|pmu] [-B batch_target_ticks] "
+                    "[-n max_trials] [-e rel_err] [-P none|sw|irq|all] [-S seed] [-o results [-f csv|jsonl|bin]]\n",
+                    argv[0]);
+            return EXIT_FAILURE;
         }
+    }
+
+    // Load the function containing the branch instruction
+    bpure_verbose = 1;
+    load_function(&arena, "branch.o", "perform_branch", target_address, 0, 1, &entry);
+    perform_branch = train_branch = test_branch = (void (*)(int))entry;
+    printf("perform_branch is loaded to %p\n", perform_branch);
+
+    // Bind the process to the requested CPU
+    bind_to_cpu(cpu);
+
+    // Drop trials that a context switch, migration, page fault or interrupt landed in
+    perturb_open(&perturb, perturb_mode, cpu);
+
+    // Calibrate the timer on the CPU it will be read on
+    timer_open_named(&timer, timer_name);
+    timer_report(&timer, stdout);
+
+    // Count branch misses directly when the kernel exposes the PMU, otherwise fall back to timing
+    if (use_pmu && pmu_open(&pmu) < 0)
+    {
+        fprintf(stderr, "PMU not available, falling back to timing\n");
+        use_pmu = 0;
+    }
+    // A syscall between the train and the test branch would bury the dummies in kernel branches
+    if (use_pmu && !pmu.user_read)
+    {
+        fprintf(stderr, "PMU counters cannot be read from user space, falling back to timing\n");
+        pmu_close(&pmu);
+        use_pmu = 0;
+    }
+    if (use_pmu)
+        printf("Counting branch misses; %d branches (%d conditional) between train and test besides the dummies\n",
+               FIXED_BRANCHES, FIXED_CONDITIONAL_BRANCHES);
 
-        double avg_time_train = (double)total_branch_time[0] / TRIALS;
-        double avg_time_test = (double)total_branch_time[1] / TRIALS;
-        int train_branches_below_avg = 0;
-        int test_branches_below_avg = 0;
+    // Each dummy count samples until its estimate reaches rel_err
+    trials_init(&tc, max_trials, rel_err);
 
-        for (int i = 0; i < TRIALS; i++)
-            if (results[i][0] < avg_time_train)
-                train_branches_below_avg++;
+    // Random # generator
+    xsrand(seed);
 
-        for (int i = 0; i < TRIALS; i++)
-            if (results[i][1] < avg_time_test)
-                test_branches_below_avg++;
+    // The shortest window, without dummy branches, decides how many trials go in one window
+    if (!use_pmu)
+    {
+        if (batch_target > 0)
+            batch_choose(&timer, measure_trials, NULL, &batch, batch_target, MAX_BATCH);
+        printf("Batch: %d trials per timed window\n", batch);
+    }
 
-        printf("Number of dummy branches: %d\n", k);
+    // One record per dummy count: net ticks per branch, or mispredicts per branch with -m pmu
+    sink_open(&sink, results_path, results_format);
+    col_dummies = sink_column(&sink, "dummies", SINK_INT);
+    col_trials = sink_column(&sink, "trials", SINK_INT);
+    col_train = sink_column(&sink, "train", SINK_FLOAT);
+    col_test = sink_column(&sink, "test", SINK_FLOAT);
+    col_test_ci = sink_column(&sink, "test_ci", SINK_FLOAT);
+    col_test_median = sink_column(&sink, "test_median", SINK_FLOAT);
+    sink_meta_system(&sink, cpu, argc, argv);
+    sink_meta(&sink, "experiment", "ghr_len");
+    sink_meta(&sink, "mode", "%s", use_pmu ? "pmu" : "time");
+    sink_meta(&sink, "timer", "%s", timer.name);
+    sink_meta(&sink, "ns_per_tick", "%g", timer.ns_per_tick);
+    sink_meta(&sink, "cpu", "%d", cpu);
+    sink_meta(&sink, "address", "%#lx", (unsigned long)target_address);
+    sink_meta(&sink, "batch", "%d", batch);
+    if (use_pmu)
+    {
+        sink_meta(&sink, "fixed_branches", "%d", FIXED_BRANCHES);
+        sink_meta(&sink, "fixed_conditional_branches", "%d", FIXED_CONDITIONAL_BRANCHES);
+    }
+    sink_meta(&sink, "max_trials", "%ld", max_trials);
+    sink_meta(&sink, "rel_err", "%g", rel_err);
+    sink_meta(&sink, "perturb", "%s", perturb_mode);
+    sink_meta(&sink, "seed", "%lu", seed);
+    sink_start(&sink);
 
-        printf("Average time for train branch: %f\n", avg_time_train);
-        // printf("Correct prediction rate for train branch: %f%%\n", (double)train_branches_below_avg / TRIALS * 100);
+    for (int i = 0; i < num_dummies; i++)
+    {
+        dummies = dummy_counts[i];
 
-        printf("Average time for test branch: %f\n", avg_time_test);
-        // printf("Correct prediction rate for test branch: %f%%\n", (double)test_branches_below_avg / TRIALS * 100);
+        printf("Number of dummy branches: %d\n", dummies);
+        if (use_pmu)
+            run_pmu();
+        else
+            run_timed();
     }
 
+    perturb_report(&perturb, stdout);
+    perturb_close(&perturb);
+    sink_close(&sink);
+    if (use_pmu)
+        pmu_close(&pmu);
+    arena_release(&arena);
+
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,307 @@
+#include <err.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "analyze.h"
+#include "changepoint.h"
+#include "sink.h"
+#include "trials.h"
+
+#define LINE_LEN 65536
+
+// What the first step of an experiment's curve says about the hardware: the x value just before it
+struct reading
+{
+    const char *experiment;
+    const char *x, *y;
+    const char *ci;    // 95% half-width of y, or NULL
+    const char *group; // Column that splits the rows into separate curves, or NULL
+    const char *what, *unit;
+};
+
+static const struct reading readings[] = {
+    {"btb_ways", "branch_num", "ticks_per_branch", "ticks_per_branch_ci", NULL, "BTB associativity", " ways"},
+    {"btb_index", "index_bits", "window_ticks", "window_ci", NULL, "Widest conflict-free stride", " index bits"},
+    {"btb_size", "branches", "ns_per_branch", NULL, "distance", "BTB capacity", " branches"},
+    {"ghr_len", "dummies", "test", "test_ci", NULL, "GHR length", " branches"},
+};
+
+#define NUM_READINGS (sizeof(readings) / sizeof(readings[0]))
+
+// A CSV result file as written by the sink
+struct table
+{
+    struct sink_meta meta[SINK_MAX_META];
+    int num_meta;
+    char columns[SINK_MAX_COLUMNS][SINK_NAME_LEN];
+    int num_columns;
+    double *rows; // num_rows x num_columns
+    int num_rows;
+};
+
+struct point
+{
+    double x, y;
+    double se; // Standard error of y, NAN if unknown
+};
+
+static void load_table(struct table *tb, const char *path)
+{
+    char line[LINE_LEN];
+    int capacity = 0;
+    FILE *f = fopen(path, "r");
+
+    if (!f)
+        err(EXIT_FAILURE, "%s", path);
+    memset(tb, 0, sizeof(*tb));
+
+    while (fgets(line, sizeof(line), f))
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0')
+            continue;
+
+        // "# key: value" metadata
+        if (line[0] == '#')
+        {
+            char *colon = strchr(line, ':');
+            if (!colon || tb->num_meta == SINK_MAX_META)
+                continue;
+            *colon = '\0';
+            snprintf(tb->meta[tb->num_meta].key, SINK_NAME_LEN, "%.*s", SINK_NAME_LEN - 1, line + 2);
+            snprintf(tb->meta[tb->num_meta].value, SINK_VALUE_LEN, "%.*s", SINK_VALUE_LEN - 1, colon + 2);
+            tb->num_meta++;
+            continue;
+        }
+
+        // Header row
+        if (tb->num_columns == 0)
+        {
+            for (char *tok = strtok(line, ","); tok && tb->num_columns < SINK_MAX_COLUMNS; tok = strtok(NULL, ","))
+                snprintf(tb->columns[tb->num_columns++], SINK_NAME_LEN, "%.*s", SINK_NAME_LEN - 1, tok);
+            continue;
+        }
+
+        if (tb->num_rows == capacity)
+        {
+            capacity = capacity ? 2 * capacity : 256;
+            tb->rows = realloc(tb->rows, (size_t)capacity * tb->num_columns * sizeof(double));
+            if (!tb->rows)
+                err(EXIT_FAILURE, "Unable to allocate the rows of %s", path);
+        }
+        double *row = tb->rows + (size_t)tb->num_rows * tb->num_columns;
+        char *p = line;
+        for (int c = 0; c < tb->num_columns; c++)
+        {
+            row[c] = strtod(p, &p);
+            if (*p == ',')
+                p++;
+        }
+        tb->num_rows++;
+    }
+    fclose(f);
+
+    if (tb->num_columns == 0)
+        errx(EXIT_FAILURE, "%s: not a CSV result file", path);
+}
+
+static const char *table_meta(const struct table *tb, const char *key)
+{
+    for (int i = 0; i < tb->num_meta; i++)
+        if (strcmp(tb->meta[i].key, key) == 0)
+            return tb->meta[i].value;
+    return NULL;
+}
+
+static int find_column(const struct table *tb, const char *name)
+{
+    for (int c = 0; c < tb->num_columns; c++)
+        if (strcmp(tb->columns[c], name) == 0)
+            return c;
+    return -1;
+}
+
+static int table_column(const struct table *tb, const char *name)
+{
+    int c = find_column(tb, name);
+
+    if (c < 0)
+        errx(EXIT_FAILURE, "No column %s in the results", name);
+    return c;
+}
+
+static int compare_point(const void *a, const void *b)
+{
+    double x = ((const struct point *)a)->x, y = ((const struct point *)b)->x;
+
+    return (x > y) - (x < y);
+}
+
+// Rows of one group sorted by x, repeated x values averaged; returns the number of points
+static int curve(const struct table *tb, int col_x, int col_y, int col_ci, int col_group, double group,
+                 struct point *pts)
+{
+    int n = 0, m = 0;
+
+    for (int r = 0; r < tb->num_rows; r++)
+    {
+        const double *row = tb->rows + (size_t)r * tb->num_columns;
+        if (col_group >= 0 && row[col_group] != group)
+            continue;
+        if (!isfinite(row[col_y]))
+            continue;
+        pts[n].x = row[col_x];
+        pts[n].y = row[col_y];
+        pts[n].se = col_ci >= 0 ? row[col_ci] / TRIALS_Z : NAN;
+        n++;
+    }
+    qsort(pts, n, sizeof(pts[0]), compare_point);
+
+    for (int i = 0; i < n;)
+    {
+        int j = i;
+        double sum = 0, var = 0;
+
+        for (; j < n && pts[j].x == pts[i].x; j++)
+        {
+            sum += pts[j].y;
+            var += pts[j].se * pts[j].se;
+        }
+        pts[m].x = pts[i].x;
+        pts[m].y = sum / (j - i);
+        pts[m].se = sqrt(var) / (j - i);
+        m++;
+        i = j;
+    }
+    return m;
+}
+
+// Fit one curve and print its steps; returns nonzero if expect is given and outside the first step's interval
+static int analyze_curve(const struct reading *rd, const struct point *pts, int n, const char *expect)
+{
+    struct segmentation sg;
+    double *y = malloc(n * sizeof(double)), *se = malloc(n * sizeof(double));
+
+    if (!y || !se)
+        err(EXIT_FAILURE, "Unable to allocate the curve");
+    for (int i = 0; i < n; i++)
+    {
+        y[i] = pts[i].y;
+        se[i] = pts[i].se;
+    }
+    changepoint_fit(&sg, y, rd->ci ? se : NULL, n);
+    free(y);
+    free(se);
+
+    printf("%d points, noise %g\n", n, sg.sigma);
+    for (int k = 0; k < sg.num; k++)
+    {
+        const struct changepoint *cp = &sg.points[k];
+        printf("Step %d after %s %g (95%% %g..%g): %s %g -> %g, z %.1f\n", k + 1, rd->x, pts[cp->index - 1].x,
+               pts[cp->lo - 1].x, pts[cp->hi - 1].x, rd->y, cp->before, cp->after, cp->z);
+    }
+    if (sg.num == 0)
+    {
+        printf("No step in %s over %s\n", rd->y, rd->x);
+        return expect != NULL;
+    }
+
+    const struct changepoint *first = &sg.points[0];
+    double value = pts[first->index - 1].x, lo = pts[first->lo - 1].x, hi = pts[first->hi - 1].x;
+    if (rd->what)
+        printf("%s ~ %g%s (95%% %g..%g)\n", rd->what, value, rd->unit, lo, hi);
+    if (!expect)
+        return 0;
+
+    double expected = atof(expect);
+    int ok = expected >= lo && expected <= hi;
+    printf("Expected %g: %s\n", expected, ok ? "consistent" : "MISMATCH");
+    return !ok;
+}
+
+int analyze(int argc, char **argv)
+{
+    struct table tb;
+    struct reading rd = {0};
+    const char *expect = NULL;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: bpure analyze results.csv [x=column] [y=column] [ci=column] [group=column] "
+                        "[expect=value]\n");
+        return EXIT_FAILURE;
+    }
+    load_table(&tb, argv[1]);
+
+    // Known experiments come with their axes and what the step measures
+    const char *experiment = table_meta(&tb, "experiment");
+    for (size_t i = 0; experiment && i < NUM_READINGS; i++)
+        if (strcmp(readings[i].experiment, experiment) == 0)
+            rd = readings[i];
+
+    for (int i = 2; i < argc; i++)
+    {
+        char *eq = strchr(argv[i], '=');
+        if (!eq)
+            errx(EXIT_FAILURE, "Expected key=value: %s", argv[i]);
+        *eq = '\0';
+        if (strcmp(argv[i], "x") == 0)
+            rd.x = eq + 1;
+        else if (strcmp(argv[i], "y") == 0)
+            rd.y = eq + 1;
+        else if (strcmp(argv[i], "ci") == 0)
+            rd.ci = eq + 1;
+        else if (strcmp(argv[i], "group") == 0)
+            rd.group = eq + 1;
+        else if (strcmp(argv[i], "expect") == 0)
+            expect = eq + 1;
+        else
+            errx(EXIT_FAILURE, "Unknown key %s (x, y, ci, group or expect)", argv[i]);
+    }
+    if (!rd.x || !rd.y)
+        errx(EXIT_FAILURE, "%s: unknown experiment %s, give x= and y=", argv[1], experiment ? experiment : "");
+
+    int col_x = table_column(&tb, rd.x), col_y = table_column(&tb, rd.y);
+    int col_group = rd.group ? table_column(&tb, rd.group) : -1;
+
+    // Results written before the experiment had a ci column are fitted on the curve's own noise
+    int col_ci = rd.ci ? find_column(&tb, rd.ci) : -1;
+    if (rd.ci && col_ci < 0)
+    {
+        printf("No column %s, noise from the curve alone\n", rd.ci);
+        rd.ci = NULL;
+    }
+    struct point *pts = malloc((tb.num_rows + 1) * sizeof(struct point));
+    int failed = 0;
+    if (!pts)
+        err(EXIT_FAILURE, "Unable to allocate the curve");
+
+    printf("%s: %s over %s", argv[1], rd.y, rd.x);
+    if (experiment)
+        printf(" (%s on %s)", experiment, table_meta(&tb, "host") ? table_meta(&tb, "host") : "unknown host");
+    printf("\n");
+
+    if (col_group < 0)
+        failed = analyze_curve(&rd, pts, curve(&tb, col_x, col_y, col_ci, -1, 0, pts), expect);
+    else
+    {
+        // One curve per distinct group value, in the order of the group column
+        struct point *groups = malloc((tb.num_rows + 1) * sizeof(struct point));
+        if (!groups)
+            err(EXIT_FAILURE, "Unable to allocate the groups");
+        int num_groups = curve(&tb, col_group, col_group, -1, -1, 0, groups);
+
+        for (int g = 0; g < num_groups; g++)
+        {
+            printf("%s %g: ", rd.group, groups[g].x);
+            failed |= analyze_curve(&rd, pts, curve(&tb, col_x, col_y, col_ci, col_group, groups[g].x, pts), expect);
+        }
+        free(groups);
+    }
+
+    free(pts);
+    free(tb.rows);
+    return failed ? EXIT_FAILURE : 0;
+}
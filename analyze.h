@@ -0,0 +1,7 @@
+#ifndef ANALYZE_H
+#define ANALYZE_H
+
+// bpure analyze: find the steps in a sweep's CSV results and what they say about the hardware
+int analyze(int argc, char **argv);
+
+#endif
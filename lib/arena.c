@@ -0,0 +1,169 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "arena.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+#define ARENA_MIN_SLOTS 64
+
+// Smallest instruction cache line, so a flush never skips part of a line
+static size_t icache_line(void)
+{
+#if defined(__aarch64__)
+    uint64_t ctr;
+    asm volatile("mrs %0, ctr_el0" : "=r"(ctr));
+    return 4 << (ctr & 0xf); // IminLine is log2 of the line size in words
+#else
+    return 64;
+#endif
+}
+
+void arena_reserve(struct code_arena *a, uintptr_t addr, size_t span)
+{
+    memset(a, 0, sizeof(*a));
+    a->page = sysconf(_SC_PAGESIZE);
+    a->line = icache_line();
+    a->span = (span + a->page - 1) & ~(a->page - 1); // Align to page size
+
+    // Anonymous pages read as zero until written, so nothing is memset or faulted in here
+    void *mem = mmap((void *)addr, a->span, PROT_READ | PROT_WRITE | PROT_EXEC,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+    if (mem == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+
+    // Kernels before 4.17 treat MAP_FIXED_NOREPLACE as a hint
+    if ((uintptr_t)mem != addr)
+    {
+        fprintf(stderr, "Could not reserve %zu bytes at %#lx\n", a->span, (unsigned long)addr);
+        munmap(mem, a->span);
+        exit(EXIT_FAILURE);
+    }
+
+    a->base = mem;
+}
+
+static int is_zero(const char *p, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        if (p[i])
+            return 0;
+    return 1;
+}
+
+// Make dst equal to src (or zero it if src is NULL), writing and flushing only the cache lines that differ
+static void sync_lines(struct code_arena *a, char *dst, const char *src, size_t size)
+{
+    char *end = dst + size;
+
+    while (dst < end)
+    {
+        char *next = (char *)(((uintptr_t)dst + a->line) & ~(uintptr_t)(a->line - 1));
+        size_t n = (next < end ? next : end) - dst;
+
+        if (src ? memcmp(dst, src, n) != 0 : !is_zero(dst, n))
+        {
+            if (src)
+                memcpy(dst, src, n);
+            else
+                memset(dst, 0, n);
+            // Clear instruction cache
+            __builtin___clear_cache(dst, dst + n);
+            a->lines++;
+        }
+
+        dst += n;
+        if (src)
+            src += n;
+    }
+}
+
+void *arena_place(struct code_arena *a, size_t offset, const void *code, size_t size)
+{
+    if (offset + size > a->span)
+    {
+        fprintf(stderr, "Placement at offset %#zx overflows the %#zx byte arena\n", offset, a->span);
+        exit(EXIT_FAILURE);
+    }
+
+    if (a->num_live == a->cap)
+    {
+        a->cap = a->cap ? 2 * a->cap : ARENA_MIN_SLOTS;
+        a->live = realloc(a->live, a->cap * sizeof(*a->live));
+        a->retired = realloc(a->retired, a->cap * sizeof(*a->retired));
+        if (!a->live || !a->retired)
+        {
+            perror("realloc");
+            exit(EXIT_FAILURE);
+        }
+    }
+    a->live[a->num_live++] = (struct arena_slot){offset, size};
+
+    char *dst = a->base + offset;
+    sync_lines(a, dst, code, size);
+    return dst;
+}
+
+void arena_reset(struct code_arena *a)
+{
+    struct arena_slot *tmp = a->retired;
+    a->retired = a->live;
+    a->num_retired = a->num_live;
+    a->live = tmp;
+    a->num_live = 0;
+}
+
+// Whether [lo, hi) intersects any live placement
+static int live_overlap(const struct code_arena *a, size_t lo, size_t hi)
+{
+    for (int i = 0; i < a->num_live; i++)
+        if (a->live[i].offset < hi && lo < a->live[i].offset + a->live[i].size)
+            return 1;
+    return 0;
+}
+
+void arena_trim(struct code_arena *a)
+{
+    for (int i = 0; i < a->num_retired; i++)
+    {
+        size_t lo = a->retired[i].offset, hi = lo + a->retired[i].size;
+        size_t page_lo = lo & ~(a->page - 1), page_hi = (hi + a->page - 1) & ~(a->page - 1);
+
+        if (!live_overlap(a, page_lo, page_hi))
+        {
+            // Nothing live shares these pages; hand them back so they read as zero again
+            madvise(a->base + page_lo, page_hi - page_lo, MADV_DONTNEED);
+            continue;
+        }
+
+        // Zero the stale bytes line by line, leaving anything the new layout placed alone
+        for (size_t off = lo; off < hi;)
+        {
+            size_t next = (off + a->line) & ~(a->line - 1);
+            if (next > hi)
+                next = hi;
+            if (!live_overlap(a, off, next))
+                sync_lines(a, a->base + off, NULL, next - off);
+            off = next;
+        }
+    }
+    a->num_retired = 0;
+}
+
+void arena_release(struct code_arena *a)
+{
+    munmap(a->base, a->span);
+    free(a->live);
+    free(a->retired);
+    memset(a, 0, sizeof(*a));
+}
@@ -0,0 +1,46 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// One piece of code placed in the arena
+struct arena_slot
+{
+    size_t offset;
+    size_t size;
+};
+
+// A large executable span reserved with MAP_NORESERVE. Only the pages code is placed in are
+// ever written, so the span can be far larger than physical memory. The arena is meant to live
+// across sweep points: arena_reset() starts a new layout, placements rewrite and flush only the
+// cache lines whose bytes actually change, and arena_trim() gives back pages only the previous
+// layout used.
+struct code_arena
+{
+    char *base;                     // Start of the reserved span
+    size_t span;                    // Size of the reservation in bytes
+    size_t page;                    // System page size
+    size_t line;                    // Instruction cache line size
+    struct arena_slot *live;        // Placements of the current layout
+    struct arena_slot *retired;     // Placements of the previous layout
+    int num_live, num_retired, cap; // Both slot arrays hold cap entries
+    size_t lines;                   // Cache lines rewritten and flushed so far
+};
+
+// Reserve span bytes at addr without committing memory; fails if anything is already mapped there
+void arena_reserve(struct code_arena *a, uintptr_t addr, size_t span);
+
+// Copy size bytes of code to base + offset; returns the placed address
+void *arena_place(struct code_arena *a, size_t offset, const void *code, size_t size);
+
+// Retire the current layout; its code stays in place until arena_trim()
+void arena_reset(struct code_arena *a);
+
+// Clear what the retired layout left behind the current one and drop pages nothing uses anymore
+void arena_trim(struct code_arena *a);
+
+// Unmap the whole span
+void arena_release(struct code_arena *a);
+
+#endif
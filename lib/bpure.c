@@ -0,0 +1,113 @@
+#define _GNU_SOURCE
+
+#include <err.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+#include "bpure.h"
+#include "elfcache.h"
+
+int bpure_verbose = 0;
+
+uint64_t xrand_state[2] = {0, 1};
+
+size_t load_function(struct code_arena *arena, const char *filename, const char *func_name, uintptr_t addr,
+                     size_t stride, int copies, void **entries)
+{
+    struct elf_cache cache;
+
+    elf_cache_open(&cache, filename);
+    const struct elf_span *func = elf_cache_get(&cache, func_name);
+    size_t size = func->size;
+
+    if (bpure_verbose)
+    {
+        printf("Symbol name: %s\n", func_name);
+        printf("Symbol size: %zu\n", size);
+        printf("Symbol offset: %zu\n", func->offset);
+        printf("Read content:\n");
+        for (size_t j = 0; j < size; ++j)
+            printf("%02x ", ((const unsigned char *)func->code)[j]);
+        printf("\n");
+    }
+
+    if (copies > 1 && size > stride)
+    {
+        fprintf(stderr, "Function size %zu does not fit in a %zu byte slot\n", size, stride);
+        exit(EXIT_FAILURE);
+    }
+
+    arena_reserve(arena, addr, copies > 1 ? stride * copies : size);
+    for (int j = 0; j < copies; j++)
+        entries[j] = arena_place(arena, j * stride, func->code, size);
+
+    elf_cache_close(&cache);
+    return size;
+}
+
+void bind_to_cpu(int cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) < 0)
+        err(EXIT_FAILURE, "Unable to set CPU affinity");
+}
+
+// splitmix64 generator -- http://xorshift.di.unimi.it/splitmix64.c
+void xsrand(uint64_t x)
+{
+    for (int i = 0; i <= 1; i++)
+    {
+        uint64_t z = (x += UINT64_C(0x9E3779B97F4A7C15));
+        z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+        z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+        xrand_state[i] = z ^ (z >> 31);
+    }
+}
+
+int parse_range(const char *spec, int *out, int max)
+{
+    char *copy = strdup(spec);
+    int n = 0;
+
+    for (char *tok = strtok(copy, ","); tok; tok = strtok(NULL, ","))
+    {
+        char *end;
+        long lo = strtol(tok, &end, 0), hi = lo, step = 1;
+        int geometric = 0;
+
+        if (strncmp(end, "..", 2) == 0)
+        {
+            hi = strtol(end + 2, &end, 0);
+            if (*end == ':' || *end == '*')
+            {
+                geometric = *end == '*';
+                step = strtol(end + 1, &end, 0);
+            }
+        }
+
+        if (*end != '\0' || lo > hi || step < 1 || (geometric && (step < 2 || lo < 1)))
+        {
+            fprintf(stderr, "Invalid range: %s\n", tok);
+            exit(EXIT_FAILURE);
+        }
+
+        for (long v = lo; v <= hi; v = geometric ? v * step : v + step)
+        {
+            if (n == max)
+            {
+                fprintf(stderr, "Range %s has more than %d values\n", spec, max);
+                exit(EXIT_FAILURE);
+            }
+            out[n++] = (int)v;
+        }
+    }
+
+    free(copy);
+    return n;
+}
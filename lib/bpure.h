@@ -0,0 +1,64 @@
+#ifndef BPURE_H
+#define BPURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+// Print the symbol size, offset and loaded bytes from load_function
+extern int bpure_verbose;
+
+// Copy func_name out of an object file into `copies` slots spaced `stride` bytes apart, starting at addr,
+// in an arena reserved there. entries[i] receives the address of slot i; the copies stay until the caller
+// calls arena_release(arena). Returns the symbol size.
+size_t load_function(struct code_arena *arena, const char *filename, const char *func_name, uintptr_t addr,
+                     size_t stride, int copies, void **entries);
+
+// Function to bind the process to a specific CPU
+void bind_to_cpu(int cpu);
+
+#if defined(__aarch64__)
+// Function to get current time; similar to rdtscp
+__attribute__((always_inline)) static inline uint64_t read_cntvct(void)
+{
+    uint64_t val;
+    asm volatile("dsb ish" ::: "memory");
+    asm volatile("mrs %0, cntvct_el0" : "=r"(val)); // Barrier before and after reading the counter
+    asm volatile("dsb ish" ::: "memory");
+    return val;
+}
+
+// Frequency of cntvct_el0 in Hz
+static inline uint64_t read_cntfrq(void)
+{
+    uint64_t val;
+    asm volatile("mrs %0, cntfrq_el0" : "=r"(val));
+    return val;
+}
+#endif
+
+//////////////////////////////////////////////
+// xorshift128+ by Sebastiano Vigna
+// from http://xorshift.di.unimi.it/xorshift128plus.c
+extern uint64_t xrand_state[2];
+
+__attribute__((always_inline)) static inline uint64_t xrand(void)
+{
+    uint64_t s1 = xrand_state[0];
+    const uint64_t s0 = xrand_state[1];
+    xrand_state[0] = s0;
+    s1 ^= s1 << 23;                                       // a
+    xrand_state[1] = s1 ^ s0 ^ (s1 >> 18) ^ (s0 >> 5);    // b, c
+    return xrand_state[1] + s0;
+}
+
+// splitmix64 seeding of the xorshift state
+void xsrand(uint64_t x);
+/////////////////////////////////////
+
+// Parse a range such as "512", "4..26", "512..4096:256", "32..256*2" or a comma separated
+// list of those into out. Returns the number of values.
+int parse_range(const char *spec, int *out, int max);
+
+#endif
@@ -0,0 +1,204 @@
+#include <err.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "changepoint.h"
+
+// Running sums so the cost of any segment takes constant time
+struct sums
+{
+    double *s1, *s2;
+};
+
+// Squared deviation of y[s..t-1] from its mean
+static double cost(const struct sums *p, int s, int t)
+{
+    double sum = p->s1[t] - p->s1[s];
+
+    return p->s2[t] - p->s2[s] - sum * sum / (t - s);
+}
+
+static double mean(const struct sums *p, int s, int t)
+{
+    return (p->s1[t] - p->s1[s]) / (t - s);
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+static double median(double *v, int n)
+{
+    qsort(v, n, sizeof(v[0]), compare_double);
+    return n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+// Standard deviation from the median absolute deviation, reordering v
+static double mad(double *v, int n)
+{
+    double m = median(v, n);
+
+    for (int i = 0; i < n; i++)
+        v[i] = fabs(v[i] - m);
+    return median(v, n) * 1.4826;
+}
+
+// Noise from the MAD of successive differences: a step moves a single difference, the noise every one.
+// Standard errors of the points, when known, are pooled in as a lower bound.
+static double noise(const double *y, const double *se, int n)
+{
+    double *d = malloc((n - 1) * sizeof(double));
+    double level = 0, var = 0;
+
+    if (!d)
+        err(EXIT_FAILURE, "Unable to allocate the differences");
+    for (int i = 0; i < n - 1; i++)
+        d[i] = y[i + 1] - y[i];
+    double sigma = mad(d, n - 1) / sqrt(2);
+    free(d);
+
+    for (int i = 0; se && i < n; i++)
+        if (isfinite(se[i]))
+            var += se[i] * se[i] / n;
+
+    // Means are only known to a relative error, and noiseless curves (simulators, replayed medians) still
+    // need a scale for the penalty, or they split on every rounding difference
+    for (int i = 0; i < n; i++)
+        level += fabs(y[i]) / n;
+    return fmax(fmax(sigma, sqrt(var)), CHANGEPOINT_RESOLUTION * level);
+}
+
+// PELT: optimal partition of y[0..n-1] at noise sigma, dropping split points that can no longer win.
+// Fills bounds[0] = 0, the changes, bounds[num + 1] = n and returns num.
+static int pelt(const struct sums *p, int n, double sigma, int *bounds, double *f, int *last, int *keep)
+{
+    double beta = CHANGEPOINT_PENALTY * sigma * sigma * log(n);
+    int num_keep = 1;
+
+    f[0] = -beta;
+    keep[0] = 0;
+    for (int t = 1; t <= n; t++)
+    {
+        f[t] = INFINITY;
+        for (int k = 0; k < num_keep; k++)
+        {
+            double c = f[keep[k]] + cost(p, keep[k], t) + beta;
+            if (c < f[t])
+            {
+                f[t] = c;
+                last[t] = keep[k];
+            }
+        }
+
+        int kept = 0;
+        for (int k = 0; k < num_keep; k++)
+            if (f[keep[k]] + cost(p, keep[k], t) <= f[t])
+                keep[kept++] = keep[k];
+        keep[kept++] = t;
+        num_keep = kept;
+    }
+
+    // Boundaries from the end
+    int num = 0;
+    for (int t = last[n]; t > 0 && num < CHANGEPOINT_MAX; t = last[t])
+        num++;
+    bounds[0] = 0;
+    bounds[num + 1] = n;
+    int i = num;
+    for (int t = last[n]; t > 0 && i > 0; t = last[t])
+        bounds[i--] = t;
+    return num;
+}
+
+int changepoint_fit(struct segmentation *sg, const double *y, const double *se, int n)
+{
+    memset(sg, 0, sizeof(*sg));
+    if (n < 2)
+        return 0;
+    sg->sigma = noise(y, se, n);
+    if (sg->sigma == 0)
+        return 0;
+
+    struct sums p;
+    double *f = malloc((n + 1) * sizeof(double));
+    double *v = malloc(n * sizeof(double));
+    int *last = malloc((n + 1) * sizeof(int)), *keep = malloc((n + 1) * sizeof(int));
+    p.s1 = malloc((n + 1) * sizeof(double));
+    p.s2 = malloc((n + 1) * sizeof(double));
+    if (!f || !v || !last || !keep || !p.s1 || !p.s2)
+        err(EXIT_FAILURE, "Unable to allocate the segmentation");
+
+    p.s1[0] = p.s2[0] = 0;
+    for (int i = 0; i < n; i++)
+    {
+        p.s1[i + 1] = p.s1[i] + y[i];
+        p.s2[i + 1] = p.s2[i] + y[i] * y[i];
+    }
+
+    // Too low a sigma splits the noise into short segments whose residuals then look small too, so the
+    // fit starts from the spread of the whole curve, which the steps can only inflate, and comes down to
+    // the spread within its segments until they agree. The noisiest segment sets it: pooling a quiet
+    // plateau with a noisy one would pull sigma under the noise that is actually there. The spread is the
+    // MAD, so a point of a ramp the coarse fit left inside a plateau does not pass for noise. noise() is
+    // the floor.
+    double floor = sg->sigma;
+    int bounds[CHANGEPOINT_MAX + 2], num = 0;
+    sg->sigma = fmax(floor, sqrt(cost(&p, 0, n) / (n - 1)));
+    for (int iter = 1;; iter++)
+    {
+        double within = floor;
+
+        num = pelt(&p, n, sg->sigma, bounds, f, last, keep);
+        if (iter == CHANGEPOINT_ITERATIONS)
+            break;
+        for (int k = 0; k <= num; k++)
+        {
+            int len = bounds[k + 1] - bounds[k];
+
+            if (len < CHANGEPOINT_MIN_SPREAD)
+                continue;
+            memcpy(v, y + bounds[k], len * sizeof(double));
+            within = fmax(within, mad(v, len));
+        }
+        if (fabs(within - sg->sigma) <= CHANGEPOINT_TOLERANCE * sg->sigma)
+            break;
+        sg->sigma = within;
+    }
+
+    // Each change against its neighbours: the step in standard errors, and every position whose fit is
+    // within the chi-square bound of the best one
+    for (int k = 1; k <= num; k++)
+    {
+        struct changepoint *cp = &sg->points[k - 1];
+        int a = bounds[k - 1], tau = bounds[k], b = bounds[k + 1];
+        double best = cost(&p, a, tau) + cost(&p, tau, b);
+
+        cp->index = tau;
+        cp->before = mean(&p, a, tau);
+        cp->after = mean(&p, tau, b);
+        cp->z = (cp->after - cp->before) / (sg->sigma * sqrt(1.0 / (tau - a) + 1.0 / (b - tau)));
+        cp->lo = cp->hi = tau;
+        for (int t = a + 1; t < b; t++)
+        {
+            if (cost(&p, a, t) + cost(&p, t, b) - best > CHANGEPOINT_CHI2 * sg->sigma * sg->sigma)
+                continue;
+            if (t < cp->lo)
+                cp->lo = t;
+            if (t > cp->hi)
+                cp->hi = t;
+        }
+    }
+    sg->num = num;
+
+    free(f);
+    free(v);
+    free(last);
+    free(keep);
+    free(p.s1);
+    free(p.s2);
+    return num;
+}
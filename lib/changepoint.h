@@ -0,0 +1,35 @@
+#ifndef CHANGEPOINT_H
+#define CHANGEPOINT_H
+
+#define CHANGEPOINT_MAX 64
+#define CHANGEPOINT_PENALTY 2.0     // Cost of a change in units of sigma^2 * log(n), as in BIC
+#define CHANGEPOINT_CHI2 3.84       // 95% quantile of chi-square with one degree of freedom
+#define CHANGEPOINT_RESOLUTION 0.01 // Least noise assumed, relative to the mean level: the trials' rel_err
+#define CHANGEPOINT_ITERATIONS 8    // Refits while the residuals disagree with the noise the fit assumed
+#define CHANGEPOINT_TOLERANCE 0.05  // Relative disagreement that ends the refits
+#define CHANGEPOINT_MIN_SPREAD 3    // Points a segment needs before its spread counts as noise
+
+struct changepoint
+{
+    int index;            // First point after the change
+    int lo, hi;           // 95% interval of index
+    double before, after; // Means of the segments either side
+    double z;             // Step in standard errors of the difference of the two means
+};
+
+// Piecewise-constant fit of a curve. sigma is the noise level the penalty and the intervals are based
+// on: the largest of the spread of successive differences, the points' own standard errors, and the
+// spread within the noisiest segment of the fit. The differences alone collapse on curves that are
+// noiseless over more than half their length, such as a zero-miss plateau before a step.
+struct segmentation
+{
+    struct changepoint points[CHANGEPOINT_MAX];
+    int num;
+    double sigma;
+};
+
+// Fit y[0..n-1] with PELT; se holds the standard error of each point, or is NULL. Returns the number of
+// changes found.
+int changepoint_fit(struct segmentation *sg, const double *y, const double *se, int n);
+
+#endif
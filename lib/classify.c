@@ -0,0 +1,178 @@
+#include <math.h>
+
+#include "classify.h"
+
+// Threshold maximising the between-class variance of the bucket values
+static int otsu(const struct hist *h, int last)
+{
+    double total = 0, sum = 0, sum0 = 0, w0 = 0, best = -1;
+    int split = -1;
+
+    for (int i = 0; i <= last; i++)
+    {
+        total += h->buckets[i];
+        sum += h->buckets[i] * hist_value(i);
+    }
+
+    for (int i = 0; i < last; i++)
+    {
+        if (!h->buckets[i])
+            continue;
+        w0 += h->buckets[i];
+        sum0 += h->buckets[i] * hist_value(i);
+        if (w0 >= total)
+            break;
+
+        double m0 = sum0 / w0, m1 = (sum - sum0) / (total - w0);
+        double between = w0 * (total - w0) * (m0 - m1) * (m0 - m1);
+        if (between > best)
+        {
+            best = between;
+            split = i;
+        }
+    }
+    return split; // Last bucket of the fast class
+}
+
+static double gauss(double x, double mean, double sd)
+{
+    double z = (x - mean) / sd;
+    return exp(-0.5 * z * z) / sd;
+}
+
+int classify_fit(struct classify *c, const struct hist *h)
+{
+    int last = hist_index(hist_percentile(h, 100 - CLASSIFY_TRIM));
+    int split = otsu(h, last);
+    double total = 0;
+
+    if (split < 0)
+        return -1;
+
+    c->limit = last + 1 < HIST_BUCKETS ? hist_lowest(last + 1) : INFINITY;
+    for (int i = 0; i <= last; i++)
+        total += h->buckets[i];
+
+    // Seed the components from the two Otsu classes
+    for (int k = 0; k < 2; k++)
+    {
+        double n = 0, s = 0, ss = 0;
+
+        for (int i = k ? split + 1 : 0; i <= (k ? last : split); i++)
+        {
+            double v = hist_value(i);
+
+            n += h->buckets[i];
+            s += h->buckets[i] * v;
+            ss += h->buckets[i] * v * v;
+        }
+        c->weight[k] = n / total;
+        c->mean[k] = s / n;
+        c->sd[k] = sqrt(fmax(ss / n - c->mean[k] * c->mean[k], 0));
+    }
+
+    // A bucket width is the floor on the spread so a population sitting in one bucket stays finite
+    for (int iter = 0; iter < CLASSIFY_EM_ITERATIONS; iter++)
+    {
+        double n[2] = {0}, s[2] = {0}, ss[2] = {0};
+
+        for (int k = 0; k < 2; k++)
+            c->sd[k] = fmax(c->sd[k], fmax(1.0, c->mean[k] * 2.0 / HIST_SUB));
+
+        for (int i = 0; i <= last; i++)
+        {
+            if (!h->buckets[i])
+                continue;
+
+            double v = hist_value(i);
+            double p0 = c->weight[0] * gauss(v, c->mean[0], c->sd[0]);
+            double p1 = c->weight[1] * gauss(v, c->mean[1], c->sd[1]);
+            double r1 = p0 + p1 > 0 ? p1 / (p0 + p1) : (v > c->mean[1] ? 1 : 0);
+            double r[2] = {1 - r1, r1};
+
+            for (int k = 0; k < 2; k++)
+            {
+                n[k] += h->buckets[i] * r[k];
+                s[k] += h->buckets[i] * r[k] * v;
+                ss[k] += h->buckets[i] * r[k] * v * v;
+            }
+        }
+
+        // Keep the Otsu seed if a component empties
+        if (n[0] < 1 || n[1] < 1)
+            break;
+
+        double shift = 0;
+        for (int k = 0; k < 2; k++)
+        {
+            double mean = s[k] / n[k];
+
+            shift += fabs(mean - c->mean[k]);
+            c->weight[k] = n[k] / total;
+            c->mean[k] = mean;
+            c->sd[k] = sqrt(fmax(ss[k] / n[k] - mean * mean, 0));
+        }
+        if (shift < 1e-6)
+            break;
+    }
+
+    for (int k = 0; k < 2; k++)
+        c->sd[k] = fmax(c->sd[k], fmax(1.0, c->mean[k] * 2.0 / HIST_SUB));
+
+    // First bucket between the means where the slow component dominates; thresholds are bucket lower
+    // bounds, so a raw trial and the bucket it is counted in always get the same label
+    c->threshold = hist_lowest(split + 1);
+    for (int i = hist_index(c->mean[0]); i <= hist_index(c->mean[1]); i++)
+    {
+        double v = hist_value(i);
+
+        if (c->weight[1] * gauss(v, c->mean[1], c->sd[1]) > c->weight[0] * gauss(v, c->mean[0], c->sd[0]))
+        {
+            c->threshold = hist_lowest(i);
+            break;
+        }
+    }
+
+    // Modes and populations on each side of the threshold
+    int best[2] = {-1, -1};
+    c->count[0] = c->count[1] = c->outliers = 0;
+    for (int i = 0; i < HIST_BUCKETS; i++)
+    {
+        int k = classify_label(c, hist_value(i));
+
+        if (k < 0)
+        {
+            c->outliers += h->buckets[i];
+            continue;
+        }
+        c->count[k] += h->buckets[i];
+        if (h->buckets[i] && (best[k] < 0 || h->buckets[i] > h->buckets[best[k]]))
+            best[k] = i;
+    }
+    for (int k = 0; k < 2; k++)
+        c->mode[k] = best[k] < 0 ? c->mean[k] : hist_value(best[k]);
+
+    c->separation = sqrt(2) * fabs(c->mean[1] - c->mean[0]) / sqrt(c->sd[0] * c->sd[0] + c->sd[1] * c->sd[1]);
+    c->resolved = c->separation >= CLASSIFY_MIN_SEPARATION;
+    return 0;
+}
+
+uint64_t classify_count(const struct classify *c, const struct hist *h, int label)
+{
+    uint64_t n = 0;
+
+    for (int i = 0; i < HIST_BUCKETS; i++)
+        if (classify_label(c, hist_value(i)) == label)
+            n += h->buckets[i];
+    return n;
+}
+
+void classify_report(const struct classify *c, FILE *out)
+{
+    fprintf(out, "Predicted mode: %.1f (mean %.1f, sd %.1f, weight %.3f)\n", c->mode[0], c->mean[0], c->sd[0],
+            c->weight[0]);
+    fprintf(out, "Mispredicted mode: %.1f (mean %.1f, sd %.1f, weight %.3f)\n", c->mode[1], c->mean[1], c->sd[1],
+            c->weight[1]);
+    fprintf(out, "Threshold: %.1f, separation %.2f (%s), %lu outliers at or above %.1f\n", c->threshold,
+            c->separation, c->resolved ? "resolved" : "modes overlap", c->outliers, c->limit);
+}
@@ -0,0 +1,46 @@
+#ifndef CLASSIFY_H
+#define CLASSIFY_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "hist.h"
+
+#define CLASSIFY_EM_ITERATIONS 200
+#define CLASSIFY_MIN_SEPARATION 2.0 // Ashman's D above which the two modes are considered resolved
+#define CLASSIFY_TRIM 0.5           // Percent of the slowest windows (interrupts, migrations) left out of the fit
+
+// Two-component fit of a latency histogram: component 0 is the fast (predicted) population,
+// component 1 the slow (mispredicted) one
+struct classify
+{
+    double threshold; // Windows below are labelled predicted
+    double mean[2];
+    double sd[2];
+    double weight[2];
+    double mode[2];     // Most populated bucket on each side of the threshold
+    double separation;  // Ashman's D: sqrt(2) |mean1 - mean0| / sqrt(sd0^2 + sd1^2)
+    uint64_t count[2];  // Samples of the fitted histogram on each side
+    uint64_t outliers;  // Samples above the trimmed range, in neither count
+    double limit;       // Windows at or above are outliers
+    int resolved;       // Separation reaches CLASSIFY_MIN_SEPARATION
+};
+
+// Drop the slowest CLASSIFY_TRIM percent of h, split the rest at the Otsu threshold, refine with EM on a two-Gaussian mixture and place the threshold where
+// the weighted densities cross. Returns -1 if h has fewer than two distinct values.
+int classify_fit(struct classify *c, const struct hist *h);
+
+// Label of one window: 0 predicted, 1 mispredicted, -1 outlier
+static inline int classify_label(const struct classify *c, double v)
+{
+    if (v >= c->limit)
+        return -1;
+    return v >= c->threshold;
+}
+
+// Samples of h labelled predicted (0), mispredicted (1) or outlier (-1) under the fit c
+uint64_t classify_count(const struct classify *c, const struct hist *h, int label);
+
+void classify_report(const struct classify *c, FILE *out);
+
+#endif
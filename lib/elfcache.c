@@ -0,0 +1,172 @@
+#include <fcntl.h>
+#include <gelf.h>
+#include <libelf.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "elfcache.h"
+
+// FNV-1a
+static uint64_t hash_name(const char *name)
+{
+    uint64_t h = 0xcbf29ce484222325;
+    while (*name)
+    {
+        h ^= (unsigned char)*name++;
+        h *= 0x100000001b3;
+    }
+    return h;
+}
+
+// Slot holding name, or the empty slot it would go into
+static unsigned find_bucket(const struct elf_cache *c, const char *name)
+{
+    unsigned mask = c->num_buckets - 1;
+    unsigned b = hash_name(name) & mask;
+
+    while (c->buckets[b] >= 0 && strcmp(c->syms[c->buckets[b]].name, name) != 0)
+        b = (b + 1) & mask;
+    return b;
+}
+
+static void build_index(struct elf_cache *c)
+{
+    c->num_buckets = 16;
+    while (c->num_buckets < 2 * (unsigned)c->num_syms)
+        c->num_buckets *= 2;
+
+    c->buckets = malloc(c->num_buckets * sizeof(*c->buckets));
+    memset(c->buckets, 0xff, c->num_buckets * sizeof(*c->buckets));
+
+    for (int i = 0; i < c->num_syms; i++)
+    {
+        unsigned b = find_bucket(c, c->syms[i].name);
+        // A function wins over a data or local label of the same name
+        if (c->buckets[b] < 0 || (!c->syms[c->buckets[b]].is_func && c->syms[i].is_func))
+            c->buckets[b] = i;
+    }
+}
+
+void elf_cache_open(struct elf_cache *c, const char *filename)
+{
+    memset(c, 0, sizeof(*c));
+
+    if (elf_version(EV_CURRENT) == EV_NONE)
+    {
+        fprintf(stderr, "ELF library initialization failed: %s\n", elf_errmsg(-1));
+        exit(EXIT_FAILURE);
+    }
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+        perror("open");
+        exit(EXIT_FAILURE);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0)
+    {
+        perror("fstat");
+        exit(EXIT_FAILURE);
+    }
+
+    // Private and writable so libelf may scribble on it without touching the file
+    c->image_size = st.st_size;
+    c->image = mmap(NULL, c->image_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (c->image == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+
+    Elf *e = elf_memory(c->image, c->image_size);
+    if (!e)
+    {
+        fprintf(stderr, "elf_memory() failed: %s\n", elf_errmsg(-1));
+        exit(EXIT_FAILURE);
+    }
+
+    Elf_Scn *scn = NULL;
+    GElf_Shdr shdr;
+    while ((scn = elf_nextscn(e, scn)) != NULL)
+    {
+        gelf_getshdr(scn, &shdr);
+        if (shdr.sh_type != SHT_SYMTAB)
+            continue;
+
+        Elf_Data *data = elf_getdata(scn, NULL);
+        int count = shdr.sh_size / shdr.sh_entsize;
+        c->syms = malloc(count * sizeof(*c->syms));
+
+        for (int i = 0; i < count; ++i)
+        {
+            GElf_Sym sym;
+            gelf_getsym(data, i, &sym);
+            const char *name = elf_strptr(e, shdr.sh_link, sym.st_name);
+
+            // Skip undefined and special symbols and the $x / $d mapping symbols
+            if (!name || !*name || name[0] == '$' || sym.st_shndx == SHN_UNDEF || sym.st_shndx >= SHN_LORESERVE)
+                continue;
+
+            // Find the section containing the symbol
+            Elf_Scn *sym_scn = elf_getscn(e, sym.st_shndx);
+            GElf_Shdr sym_shdr;
+            gelf_getshdr(sym_scn, &sym_shdr);
+            if (sym_shdr.sh_type == SHT_NOBITS)
+                continue;
+
+            // Calculate the file offset of the symbol
+            size_t offset = sym_shdr.sh_offset + (sym.st_value - sym_shdr.sh_addr);
+            if (offset + sym.st_size > c->image_size)
+            {
+                fprintf(stderr, "Symbol %s lies outside %s\n", name, filename);
+                exit(EXIT_FAILURE);
+            }
+
+            c->syms[c->num_syms++] = (struct elf_span){
+                .name = name,
+                .code = c->image + offset,
+                .size = sym.st_size,
+                .offset = offset,
+                .is_func = GELF_ST_TYPE(sym.st_info) == STT_FUNC,
+            };
+        }
+        break;
+    }
+
+    // Names and bytes point into the image, so the libelf handle is not needed anymore
+    elf_end(e);
+    build_index(c);
+}
+
+const struct elf_span *elf_cache_lookup(const struct elf_cache *c, const char *name)
+{
+    int i = c->buckets[find_bucket(c, name)];
+    return i < 0 ? NULL : &c->syms[i];
+}
+
+const struct elf_span *elf_cache_get(const struct elf_cache *c, const char *name)
+{
+    const struct elf_span *sym = elf_cache_lookup(c, name);
+    if (!sym)
+    {
+        fprintf(stderr, "Symbol %s not found\n", name);
+        exit(EXIT_FAILURE);
+    }
+    return sym;
+}
+
+void elf_cache_close(struct elf_cache *c)
+{
+    munmap(c->image, c->image_size);
+    free(c->syms);
+    free(c->buckets);
+    memset(c, 0, sizeof(*c));
+}
@@ -0,0 +1,39 @@
+#ifndef ELFCACHE_H
+#define ELFCACHE_H
+
+#include <stddef.h>
+
+// Bytes of one symbol, pointing straight into the mapped object
+struct elf_span
+{
+    const char *name;
+    const void *code;
+    size_t size;
+    size_t offset; // File offset of the symbol
+    int is_func;
+};
+
+// An object file mapped once with a hash index over its symbol table
+struct elf_cache
+{
+    char *image;             // Private mapping of the whole file
+    size_t image_size;
+    struct elf_span *syms;
+    int num_syms;
+    int *buckets;            // Open addressing table of indices into syms, -1 if empty
+    unsigned num_buckets;    // Power of two
+};
+
+// Map filename and index every symbol that has bytes in the file; exits on failure
+void elf_cache_open(struct elf_cache *c, const char *filename);
+
+// Returns NULL if name is not in the object
+const struct elf_span *elf_cache_lookup(const struct elf_cache *c, const char *name);
+
+// Same as elf_cache_lookup but exits if name is missing
+const struct elf_span *elf_cache_get(const struct elf_cache *c, const char *name);
+
+// Spans handed out before are invalid afterwards
+void elf_cache_close(struct elf_cache *c);
+
+#endif
@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "emit.h"
+
+#define A64_B 0x14000000     // b imm26
+#define A64_BCOND 0x54000000 // b.cond imm19
+#define A64_MOVZ 0x52800000  // movz wd, #imm16
+#define A64_SUBS 0x71000000  // subs wd, wn, #imm12
+#define A64_SF (1u << 31)    // 64-bit variant of mov / subs
+#define A64_ZR 31            // wzr / xzr
+
+void emit_init(struct emit_buf *eb, void *addr, size_t size)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    size = (size + page - 1) & ~(page - 1); // Align to page size
+
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (addr)
+        flags |= MAP_FIXED;
+
+    void *mem = mmap(addr, size, PROT_READ | PROT_WRITE | PROT_EXEC, flags, -1, 0);
+    if (mem == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+
+    eb->code = mem;
+    eb->size = size;
+    eb->cap = size / sizeof(uint32_t);
+    eb->len = 0;
+}
+
+void emit_free(struct emit_buf *eb)
+{
+    munmap(eb->code, eb->size);
+    eb->code = NULL;
+    eb->size = eb->cap = eb->len = 0;
+}
+
+void emit_reset(struct emit_buf *eb)
+{
+    eb->len = 0;
+}
+
+uint32_t *emit_insn(struct emit_buf *eb, uint32_t insn)
+{
+    if (eb->len >= eb->cap)
+    {
+        fprintf(stderr, "Emit buffer overflow: %zu instructions\n", eb->cap);
+        exit(EXIT_FAILURE);
+    }
+
+    uint32_t *p = eb->code + eb->len++;
+    *p = insn;
+    return p;
+}
+
+uint32_t *emit_nop(struct emit_buf *eb)
+{
+    return emit_insn(eb, A64_NOP);
+}
+
+uint32_t *emit_ret(struct emit_buf *eb)
+{
+    return emit_insn(eb, A64_RET);
+}
+
+// Word offset from insn to target, checked against the width of the immediate field
+static uint32_t branch_imm(const uint32_t *insn, const uint32_t *target, int bits)
+{
+    ptrdiff_t off = target - insn;
+    ptrdiff_t lim = (ptrdiff_t)1 << (bits - 1);
+    if (off < -lim || off >= lim)
+    {
+        fprintf(stderr, "Branch at %p cannot reach %p\n", (void *)insn, (void *)target);
+        exit(EXIT_FAILURE);
+    }
+    return (uint32_t)off & ((1u << bits) - 1);
+}
+
+void emit_patch(uint32_t *insn, const uint32_t *target)
+{
+    if ((*insn & 0xfc000000) == A64_B)
+        *insn = A64_B | branch_imm(insn, target, 26);
+    else if ((*insn & 0xff000010) == A64_BCOND)
+        *insn = A64_BCOND | (branch_imm(insn, target, 19) << 5) | (*insn & 0xf);
+    else
+    {
+        fprintf(stderr, "Cannot patch non-branch instruction %08x at %p\n", *insn, (void *)insn);
+        exit(EXIT_FAILURE);
+    }
+}
+
+uint32_t *emit_b(struct emit_buf *eb, const uint32_t *target)
+{
+    uint32_t *p = emit_insn(eb, A64_B);
+    if (target)
+        emit_patch(p, target);
+    return p;
+}
+
+uint32_t *emit_bcond(struct emit_buf *eb, enum a64_cond cond, const uint32_t *target)
+{
+    uint32_t *p = emit_insn(eb, A64_BCOND | (cond & 0xf));
+    if (target)
+        emit_patch(p, target);
+    return p;
+}
+
+uint32_t *emit_mov(struct emit_buf *eb, int rd, uint16_t imm, int sf)
+{
+    return emit_insn(eb, (sf ? A64_SF : 0) | A64_MOVZ | ((uint32_t)imm << 5) | (rd & 0x1f));
+}
+
+uint32_t *emit_subs(struct emit_buf *eb, int rd, int rn, uint32_t imm, int sf)
+{
+    if (imm > 0xfff)
+    {
+        fprintf(stderr, "Immediate %u does not fit in 12 bits\n", imm);
+        exit(EXIT_FAILURE);
+    }
+    return emit_insn(eb, (sf ? A64_SF : 0) | A64_SUBS | (imm << 10) | ((rn & 0x1f) << 5) | (rd & 0x1f));
+}
+
+uint32_t *emit_cmp(struct emit_buf *eb, int rn, uint32_t imm, int sf)
+{
+    return emit_subs(eb, A64_ZR, rn, imm, sf);
+}
+
+void *emit_finish(struct emit_buf *eb)
+{
+    // Clear instruction cache
+    __builtin___clear_cache((char *)eb->code, (char *)(eb->code + eb->len));
+    return eb->code;
+}
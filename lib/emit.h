@@ -0,0 +1,72 @@
+#ifndef EMIT_H
+#define EMIT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define A64_NOP 0xd503201f // nop
+#define A64_RET 0xd65f03c0 // ret (x30)
+
+// Condition codes used by b.cond
+enum a64_cond
+{
+    A64_EQ = 0x0,
+    A64_NE = 0x1,
+    A64_HS = 0x2,
+    A64_LO = 0x3,
+    A64_MI = 0x4,
+    A64_PL = 0x5,
+    A64_VS = 0x6,
+    A64_VC = 0x7,
+    A64_HI = 0x8,
+    A64_LS = 0x9,
+    A64_GE = 0xa,
+    A64_LT = 0xb,
+    A64_GT = 0xc,
+    A64_LE = 0xd,
+    A64_AL = 0xe,
+};
+
+// Executable buffer the instructions are written into
+struct emit_buf
+{
+    uint32_t *code; // Start of the mmap'd RWX buffer
+    size_t size;    // Size of the mapping in bytes
+    size_t cap;     // Capacity in instructions
+    size_t len;     // Number of instructions emitted so far
+};
+
+// Map an executable buffer of at least size bytes; addr == NULL lets the kernel pick the address
+void emit_init(struct emit_buf *eb, void *addr, size_t size);
+void emit_free(struct emit_buf *eb);
+
+// Rewind the buffer so a new layout can be emitted over the old one
+void emit_reset(struct emit_buf *eb);
+
+// Address the next instruction will be written to
+static inline uint32_t *emit_here(const struct emit_buf *eb)
+{
+    return eb->code + eb->len;
+}
+
+// Each emitter returns the address of the instruction it wrote
+uint32_t *emit_insn(struct emit_buf *eb, uint32_t insn);
+uint32_t *emit_nop(struct emit_buf *eb);
+uint32_t *emit_ret(struct emit_buf *eb);
+
+// target == NULL emits a placeholder that has to be resolved with emit_patch()
+uint32_t *emit_b(struct emit_buf *eb, const uint32_t *target);
+uint32_t *emit_bcond(struct emit_buf *eb, enum a64_cond cond, const uint32_t *target);
+
+// sf selects the 64-bit (x) form instead of the 32-bit (w) form
+uint32_t *emit_mov(struct emit_buf *eb, int rd, uint16_t imm, int sf);            // movz rd, #imm
+uint32_t *emit_cmp(struct emit_buf *eb, int rn, uint32_t imm, int sf);            // cmp rn, #imm
+uint32_t *emit_subs(struct emit_buf *eb, int rd, int rn, uint32_t imm, int sf);   // subs rd, rn, #imm
+
+// Point an already emitted b / b.cond at target
+void emit_patch(uint32_t *insn, const uint32_t *target);
+
+// Flush the instruction cache over the emitted code and return its entry point
+void *emit_finish(struct emit_buf *eb);
+
+#endif
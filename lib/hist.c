@@ -0,0 +1,153 @@
+#include <string.h>
+
+#include "hist.h"
+
+#define HIST_MAGIC 0x54534948 // "HIST"
+
+void hist_init(struct hist *h)
+{
+    memset(h, 0, sizeof(*h));
+    h->min = UINT64_MAX;
+}
+
+uint64_t hist_lowest(int idx)
+{
+    if (idx < HIST_SUB)
+        return idx;
+
+    int shift = (idx - HIST_SUB) / (HIST_SUB / 2) + 1;
+    uint64_t sub = (idx - HIST_SUB) % (HIST_SUB / 2) + HIST_SUB / 2;
+    return sub << shift;
+}
+
+double hist_value(int idx)
+{
+    if (idx < HIST_SUB)
+        return idx;
+
+    int shift = (idx - HIST_SUB) / (HIST_SUB / 2) + 1;
+    return hist_lowest(idx) + ((1ULL << shift) - 1) / 2.0;
+}
+
+double hist_mean(const struct hist *h)
+{
+    return h->count ? h->sum / h->count : 0;
+}
+
+double hist_percentile(const struct hist *h, double p)
+{
+    if (!h->count)
+        return 0;
+
+    // Rank of the sample wanted, 1-based
+    uint64_t rank = (uint64_t)(p / 100 * h->count + 0.5);
+    uint64_t seen = 0;
+
+    if (rank < 1)
+        rank = 1;
+    for (int i = 0; i < HIST_BUCKETS; i++)
+    {
+        seen += h->buckets[i];
+        if (seen >= rank)
+        {
+            // The extremes are known exactly
+            if (i == hist_index(h->min))
+                return h->min;
+            if (i == hist_index(h->max))
+                return h->max;
+            return hist_value(i);
+        }
+    }
+    return h->max;
+}
+
+double hist_mode(const struct hist *h)
+{
+    int best = 0;
+
+    for (int i = 1; i < HIST_BUCKETS; i++)
+        if (h->buckets[i] > h->buckets[best])
+            best = i;
+    return hist_value(best);
+}
+
+uint64_t hist_count_below(const struct hist *h, double v)
+{
+    uint64_t below = 0;
+
+    for (int i = 0; i < HIST_BUCKETS && hist_value(i) < v; i++)
+        below += h->buckets[i];
+    return below;
+}
+
+void hist_merge(struct hist *dst, const struct hist *src)
+{
+    for (int i = 0; i < HIST_BUCKETS; i++)
+        dst->buckets[i] += src->buckets[i];
+    dst->count += src->count;
+    dst->sum += src->sum;
+    if (src->min < dst->min)
+        dst->min = src->min;
+    if (src->max > dst->max)
+        dst->max = src->max;
+}
+
+// Little-endian fixed-width fields so files move between machines
+static int put_u64(uint64_t v, FILE *out)
+{
+    unsigned char b[8];
+
+    for (int i = 0; i < 8; i++)
+        b[i] = v >> (8 * i);
+    return fwrite(b, sizeof(b), 1, out) == 1 ? 0 : -1;
+}
+
+static int get_u64(uint64_t *v, FILE *in)
+{
+    unsigned char b[8];
+
+    if (fread(b, sizeof(b), 1, in) != 1)
+        return -1;
+    *v = 0;
+    for (int i = 0; i < 8; i++)
+        *v |= (uint64_t)b[i] << (8 * i);
+    return 0;
+}
+
+int hist_save(const struct hist *h, FILE *out)
+{
+    uint64_t used = 0, sum;
+
+    for (int i = 0; i < HIST_BUCKETS; i++)
+        used += h->buckets[i] != 0;
+
+    memcpy(&sum, &h->sum, sizeof(sum));
+    if (put_u64(HIST_MAGIC, out) || put_u64(HIST_SUB_BITS, out) || put_u64(h->count, out) || put_u64(h->min, out) ||
+        put_u64(h->max, out) || put_u64(sum, out) || put_u64(used, out))
+        return -1;
+
+    for (int i = 0; i < HIST_BUCKETS; i++)
+        if (h->buckets[i] && (put_u64(i, out) || put_u64(h->buckets[i], out)))
+            return -1;
+    return 0;
+}
+
+int hist_load(struct hist *h, FILE *in)
+{
+    uint64_t magic, bits, used, sum, idx;
+
+    hist_init(h);
+    if (get_u64(&magic, in) || get_u64(&bits, in) || magic != HIST_MAGIC || bits != HIST_SUB_BITS)
+        return -1;
+    if (get_u64(&h->count, in) || get_u64(&h->min, in) || get_u64(&h->max, in) || get_u64(&sum, in) ||
+        get_u64(&used, in))
+        return -1;
+    memcpy(&h->sum, &sum, sizeof(sum));
+
+    for (uint64_t i = 0; i < used; i++)
+    {
+        if (get_u64(&idx, in) || idx >= HIST_BUCKETS || get_u64(&h->buckets[idx], in))
+            return -1;
+    }
+    return 0;
+}
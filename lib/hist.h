@@ -0,0 +1,71 @@
+#ifndef HIST_H
+#define HIST_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Log-linear histogram: values below HIST_SUB are counted exactly, above that every power of two is
+// split into HIST_SUB / 2 buckets, so a recorded value is off by less than 2 / HIST_SUB (1.6%)
+#define HIST_SUB_BITS 7
+#define HIST_SUB (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS (HIST_SUB + (64 - HIST_SUB_BITS) * (HIST_SUB / 2))
+
+// Fixed size, about 30 KB; keep it out of the stack in hot paths
+struct hist
+{
+    uint64_t count;
+    uint64_t min;
+    uint64_t max;
+    double sum;
+    uint64_t buckets[HIST_BUCKETS];
+};
+
+static inline int hist_index(uint64_t v)
+{
+    if (v < HIST_SUB)
+        return (int)v;
+
+    int shift = 64 - __builtin_clzll(v) - HIST_SUB_BITS;
+    return HIST_SUB + (shift - 1) * (HIST_SUB / 2) + (int)(v >> shift) - HIST_SUB / 2;
+}
+
+// Constant time and no allocation
+static inline void hist_record(struct hist *h, uint64_t v)
+{
+    h->buckets[hist_index(v)]++;
+    h->count++;
+    h->sum += v;
+    if (v < h->min)
+        h->min = v;
+    if (v > h->max)
+        h->max = v;
+}
+
+void hist_init(struct hist *h);
+
+// Smallest value that falls into bucket idx
+uint64_t hist_lowest(int idx);
+
+// Value reported for bucket idx: the middle of its range
+double hist_value(int idx);
+
+double hist_mean(const struct hist *h);
+
+// Value below which p percent of the samples lie, p in [0, 100]
+double hist_percentile(const struct hist *h, double p);
+
+// Value of the most populated bucket
+double hist_mode(const struct hist *h);
+
+// Samples recorded below v, exact under HIST_SUB and to bucket granularity above
+uint64_t hist_count_below(const struct hist *h, double v);
+
+// Add the samples of src to dst
+void hist_merge(struct hist *dst, const struct hist *src);
+
+// Portable binary form listing only the populated buckets. Both return 0, or -1 on I/O error or a
+// malformed stream.
+int hist_save(const struct hist *h, FILE *out);
+int hist_load(struct hist *h, FILE *in);
+
+#endif
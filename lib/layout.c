@@ -0,0 +1,35 @@
+#include "layout.h"
+
+// The same loop body gencode.c used to write out as C source
+void *layout_loop(struct emit_buf *eb, int dist, int branches)
+{
+    int num_nop = dist / 4 - 3; // exclude ble, mov and cmp
+
+    emit_reset(eb);
+    uint32_t *top = emit_here(eb);
+
+    emit_mov(eb, LAYOUT_REG_COND, 10, 0);
+    emit_cmp(eb, LAYOUT_REG_COND, 15, 0);
+
+    for (int j = 0; j < branches - 1; j++)
+    {
+        uint32_t *ble = emit_bcond(eb, A64_LE, NULL);
+        for (int k = 0; k < num_nop; k++)
+            emit_nop(eb);
+        emit_patch(ble, emit_here(eb));
+        emit_mov(eb, LAYOUT_REG_COND, 10, 0);
+        emit_cmp(eb, LAYOUT_REG_COND, 15, 0);
+    }
+
+    emit_nop(eb); // last branch target
+
+    // The back-edge is an unconditional b so that layouts over 1 MB stay in range;
+    // the loop exit is a not-taken b.eq and does not need a BTB entry
+    emit_subs(eb, LAYOUT_REG_ITER, LAYOUT_REG_ITER, 1, 1);
+    uint32_t *done = emit_bcond(eb, A64_EQ, NULL);
+    emit_b(eb, top);
+    emit_patch(done, emit_here(eb));
+    emit_ret(eb);
+
+    return emit_finish(eb);
+}
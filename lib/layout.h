@@ -0,0 +1,14 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include "emit.h"
+
+#define LAYOUT_REG_COND 9 // w9 holds the value compared by every branch
+#define LAYOUT_REG_ITER 0 // x0 is the iteration count passed by the caller
+
+// Loop of `branches` always taken branches `dist` bytes apart, the last of which is the back-edge, as
+// measured by BTB/Size and replayed by the simulator. Called as void loop(uint64_t iterations); returns
+// the entry point. dist must be a multiple of 4 and at least 12.
+void *layout_loop(struct emit_buf *eb, int dist, int branches);
+
+#endif
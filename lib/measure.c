@@ -0,0 +1,68 @@
+#include <stdlib.h>
+
+#include "emit.h"
+#include "measure.h"
+
+void *empty_gadget(void)
+{
+    static struct emit_buf eb;
+
+    if (!eb.code)
+    {
+        emit_init(&eb, NULL, sizeof(uint32_t));
+        emit_ret(&eb);
+    }
+    return emit_finish(&eb);
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return x < y ? -1 : x > y;
+}
+
+void overhead_calibrate(struct overhead *o, uint64_t (*measure)(void *ctx), void *ctx, int samples)
+{
+    double *deltas = malloc(samples * sizeof(*deltas));
+
+    for (int i = 0; i < samples; i++)
+        deltas[i] = measure(ctx);
+
+    qsort(deltas, samples, sizeof(*deltas), compare_double);
+    o->samples = samples;
+    o->min = deltas[0];
+    o->median = deltas[samples / 2];
+
+    for (int i = 0; i < samples; i++)
+        deltas[i] = deltas[i] > o->median ? deltas[i] - o->median : o->median - deltas[i];
+    qsort(deltas, samples, sizeof(*deltas), compare_double);
+    o->mad = deltas[samples / 2];
+
+    free(deltas);
+}
+
+void overhead_report(const struct overhead *o, const struct timer *t, FILE *out)
+{
+    fprintf(out, "Overhead: median %.1f ticks (%f ns), min %.1f, MAD %.1f over %d samples\n", o->median,
+            o->median * t->ns_per_tick, o->min, o->mad, o->samples);
+}
+
+int batch_choose(const struct timer *t, uint64_t (*measure)(void *ctx), void *ctx, int *batch, double target_ticks,
+                 int max_batch)
+{
+    double probes[BATCH_PROBES];
+
+    for (*batch = 1; *batch < max_batch; *batch *= 2)
+    {
+        for (int i = 0; i < BATCH_PROBES; i++)
+            probes[i] = measure(ctx);
+        qsort(probes, BATCH_PROBES, sizeof(*probes), compare_double);
+
+        if (probes[BATCH_PROBES / 2] - t->overhead >= target_ticks)
+            break;
+    }
+
+    if (*batch > max_batch)
+        *batch = max_batch;
+    return *batch;
+}
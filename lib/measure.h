@@ -0,0 +1,43 @@
+#ifndef MEASURE_H
+#define MEASURE_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "timer.h"
+
+#define OVERHEAD_SAMPLES 10000
+#define BATCH_TARGET_TICKS 64 // Default signal a batched window should span
+#define BATCH_PROBES 101      // Windows timed per candidate batch size
+
+// Distribution of the fixed cost of a timed window: barriers, counter reads and the calls
+// through function pointers, measured with every gadget swapped for an empty one
+struct overhead
+{
+    double median; // Ticks
+    double min;
+    double mad;    // Median absolute deviation
+    int samples;
+};
+
+// A lone `ret` in its own executable page; callable through any of the gadget pointer types
+void *empty_gadget(void);
+
+// Run measure(ctx) `samples` times and summarise the raw deltas it returns
+void overhead_calibrate(struct overhead *o, uint64_t (*measure)(void *ctx), void *ctx, int samples);
+
+void overhead_report(const struct overhead *o, const struct timer *t, FILE *out);
+
+// Raw ticks with the median overhead removed
+static inline double overhead_net(const struct overhead *o, double raw)
+{
+    return raw - o->median;
+}
+
+// Pick how many replicas of a gadget go in one timed window. *batch is doubled from 1 until the
+// median of BATCH_PROBES calls of measure(ctx), less the timer's own read overhead, spans at least
+// target_ticks or max_batch is reached; measure must time *batch replicas. Returns the chosen size.
+int batch_choose(const struct timer *t, uint64_t (*measure)(void *ctx), void *ctx, int *batch, double target_ticks,
+                 int max_batch);
+
+#endif
@@ -0,0 +1,263 @@
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "perturb.h"
+
+#define IRQ_BUF_SIZE 65536
+
+static const uint64_t sw_configs[PERTURB_NUM_SW] = {
+    [PERTURB_CONTEXT_SWITCHES] = PERF_COUNT_SW_CONTEXT_SWITCHES,
+    [PERTURB_MIGRATIONS] = PERF_COUNT_SW_CPU_MIGRATIONS,
+    [PERTURB_PAGE_FAULTS] = PERF_COUNT_SW_PAGE_FAULTS,
+};
+
+static const char *signal_names[PERTURB_NUM_SIGNALS] = {
+    [PERTURB_CONTEXT_SWITCHES] = "context-switches",
+    [PERTURB_MIGRATIONS] = "cpu-migrations",
+    [PERTURB_PAGE_FAULTS] = "page-faults",
+    [PERTURB_INTERRUPTS] = "interrupts",
+};
+
+const char *perturb_signal_name(enum perturb_signal s)
+{
+    return s < PERTURB_NUM_SIGNALS ? signal_names[s] : "unknown";
+}
+
+static int open_sw(struct perturb *p, uint64_t config, int group_fd)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_SOFTWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_hv = 1;
+
+    // Context switches and migrations happen in the kernel; counting them needs perf_event_paranoid <= 1.
+    // Excluding the kernel still catches page faults taken from user space.
+    int fd = syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+    if (fd >= 0)
+        return fd;
+    attr.exclude_kernel = 1;
+    fd = syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+    if (fd >= 0)
+        p->user_only = 1;
+    return fd;
+}
+
+static int open_sw_group(struct perturb *p)
+{
+    for (int i = 0; i < PERTURB_NUM_SW; i++)
+    {
+        p->fds[i] = open_sw(p, sw_configs[i], i == 0 ? -1 : p->fds[0]);
+        if (p->fds[i] < 0)
+        {
+            // Half a group is no use; close what was opened so far
+            while (--i >= 0)
+            {
+                close(p->fds[i]);
+                p->fds[i] = -1;
+            }
+            p->user_only = 0;
+            return -1;
+        }
+    }
+    ioctl(p->fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return 0;
+}
+
+// Whole file in p->buf, growing it until the file fits
+static ssize_t read_interrupts(struct perturb *p)
+{
+    ssize_t n;
+
+    while ((n = pread(p->irq_fd, p->buf, p->buf_size - 1, 0)) == (ssize_t)p->buf_size - 1)
+    {
+        p->buf_size *= 2;
+        p->buf = realloc(p->buf, p->buf_size);
+    }
+    if (n >= 0)
+        p->buf[n] = '\0';
+    return n;
+}
+
+// The header names the online CPUs only, so the column of cpu has to be looked up
+static int open_irq(struct perturb *p, int cpu)
+{
+    char name[32];
+
+    p->irq_fd = open("/proc/interrupts", O_RDONLY);
+    if (p->irq_fd < 0)
+        return -1;
+    p->buf_size = IRQ_BUF_SIZE;
+    p->buf = malloc(p->buf_size);
+    if (read_interrupts(p) < 0)
+        return -1;
+
+    snprintf(name, sizeof(name), "CPU%d", cpu);
+    p->irq_column = 0;
+    for (char *tok = p->buf; *tok && *tok != '\n'; p->irq_column++)
+    {
+        while (*tok == ' ')
+            tok++;
+        size_t len = strcspn(tok, " \n");
+        if (len == strlen(name) && strncmp(tok, name, len) == 0)
+            return 0;
+        tok += len;
+    }
+    return -1;
+}
+
+static uint64_t cpu_interrupts(struct perturb *p)
+{
+    uint64_t total = 0;
+
+    if (read_interrupts(p) < 0)
+        return 0;
+
+    // Skip the header, then every line is "NAME: count count ... description"
+    for (char *line = strchr(p->buf, '\n'); line && line[1]; line = strchr(line + 1, '\n'))
+    {
+        char *s = strchr(line + 1, ':');
+        char *end = strchr(line + 1, '\n');
+
+        if (!s || (end && s > end))
+            continue;
+        s++;
+        for (int col = 0; col <= p->irq_column; col++)
+        {
+            char *next;
+            uint64_t v = strtoull(s, &next, 10);
+
+            if (next == s)
+                break; // Short rows such as ERR and MIS carry a single total
+            if (col == p->irq_column)
+                total += v;
+            s = next;
+        }
+    }
+    return total;
+}
+
+int perturb_open(struct perturb *p, const char *mode, int cpu)
+{
+    memset(p, 0, sizeof(*p));
+    for (int i = 0; i < PERTURB_NUM_SW; i++)
+        p->fds[i] = -1;
+    p->irq_fd = -1;
+
+    if (strcmp(mode, "sw") == 0)
+        p->mode = PERTURB_SW;
+    else if (strcmp(mode, "irq") == 0)
+        p->mode = PERTURB_IRQ;
+    else if (strcmp(mode, "all") == 0)
+        p->mode = PERTURB_SW | PERTURB_IRQ;
+    else if (strcmp(mode, "none") != 0)
+    {
+        fprintf(stderr, "Unknown perturbation mode: %s (expected none, sw, irq or all)\n", mode);
+        exit(EXIT_FAILURE);
+    }
+
+    if ((p->mode & PERTURB_SW) && open_sw_group(p) < 0)
+    {
+        fprintf(stderr, "perf software counters not available, not watching them\n");
+        p->mode &= ~PERTURB_SW;
+    }
+    else if ((p->mode & PERTURB_SW) && p->user_only)
+        fprintf(stderr, "perf software counters limited to user space (perf_event_paranoid > 1), "
+                        "context switches and migrations go unseen\n");
+    if ((p->mode & PERTURB_IRQ) && open_irq(p, cpu) < 0)
+    {
+        fprintf(stderr, "CPU%d not found in /proc/interrupts, not watching interrupts\n", cpu);
+        p->mode &= ~PERTURB_IRQ;
+    }
+
+    return p->mode;
+}
+
+void perturb_read(struct perturb *p, struct perturb_counts *c)
+{
+    memset(c, 0, sizeof(*c));
+
+    if (p->mode & PERTURB_SW)
+    {
+        uint64_t buf[1 + PERTURB_NUM_SW]; // nr followed by one value per event
+
+        if (read(p->fds[0], buf, sizeof(buf)) == sizeof(buf))
+            memcpy(c->v, buf + 1, sizeof(uint64_t) * PERTURB_NUM_SW);
+    }
+    if (p->mode & PERTURB_IRQ)
+        c->v[PERTURB_INTERRUPTS] = cpu_interrupts(p);
+}
+
+int perturb_end(struct perturb *p, const struct perturb_counts *start)
+{
+    struct perturb_counts end;
+    int perturbed = 0;
+
+    if (!p->mode)
+        return 0;
+
+    perturb_read(p, &end);
+    p->trials++;
+    for (int i = 0; i < PERTURB_NUM_SIGNALS; i++)
+    {
+        if (end.v[i] != start->v[i])
+        {
+            p->hits[i]++;
+            perturbed = 1;
+        }
+    }
+    p->rejected += perturbed;
+    return perturbed;
+}
+
+int perturb_give_up(struct perturb *p, long *attempts, long max)
+{
+    if ((*attempts)++ < max)
+        return 0;
+
+    fprintf(stderr, "Stopping after %ld attempts, too many trials perturbed\n", max);
+    p->gave_up++;
+    return 1;
+}
+
+void perturb_report(const struct perturb *p, FILE *out)
+{
+    if (!p->mode)
+        return;
+
+    fprintf(out, "Perturbed trials dropped: %lu of %lu (%.2f%%)", p->rejected, p->trials,
+            p->trials ? 100.0 * p->rejected / p->trials : 0);
+    for (int i = 0; i < PERTURB_NUM_SIGNALS; i++)
+        if (p->hits[i])
+            fprintf(out, ", %s %lu", signal_names[i], p->hits[i]);
+    if (p->gave_up)
+        fprintf(out, ", %lu points stopped at the attempt cap", p->gave_up);
+    if ((p->mode & PERTURB_SW) && p->user_only)
+        fprintf(out, "; user-space counters, context switches and migrations unseen");
+    fprintf(out, "\n");
+}
+
+void perturb_close(struct perturb *p)
+{
+    for (int i = PERTURB_NUM_SW - 1; i >= 0; i--)
+    {
+        if (p->fds[i] >= 0)
+            close(p->fds[i]);
+        p->fds[i] = -1;
+    }
+    if (p->irq_fd >= 0)
+        close(p->irq_fd);
+    p->irq_fd = -1;
+    free(p->buf);
+    p->buf = NULL;
+    p->mode = 0;
+}
@@ -0,0 +1,70 @@
+#ifndef PERTURB_H
+#define PERTURB_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Signals read around each trial; any change marks the trial as perturbed
+enum perturb_signal
+{
+    PERTURB_CONTEXT_SWITCHES,
+    PERTURB_MIGRATIONS,
+    PERTURB_PAGE_FAULTS,
+    PERTURB_INTERRUPTS,
+    PERTURB_NUM_SIGNALS,
+};
+
+#define PERTURB_NUM_SW PERTURB_INTERRUPTS // The perf software counters come first
+
+// Which signals to watch
+#define PERTURB_SW 0x1  // perf software counters, one group read per side
+#define PERTURB_IRQ 0x2 // This CPU's column of /proc/interrupts, tens of microseconds per read
+
+struct perturb_counts
+{
+    uint64_t v[PERTURB_NUM_SIGNALS];
+};
+
+struct perturb
+{
+    int mode;
+    int fds[PERTURB_NUM_SW]; // fds[0] leads the group
+    int irq_fd;
+    int irq_column;          // Column of the bound CPU in /proc/interrupts
+    char *buf;
+    size_t buf_size;
+    uint64_t trials;
+    uint64_t rejected;
+    uint64_t hits[PERTURB_NUM_SIGNALS]; // Rejected trials each signal fired in
+    uint64_t gave_up;                    // Points stopped by perturb_give_up
+    int user_only;                       // Software counters exclude the kernel, see perturb_open
+};
+
+// mode is "none", "sw", "irq" or "all"; cpu is the CPU the caller is bound to. Signals that cannot be
+// opened are dropped from the mode with a warning. Software counters the kernel only allows for user space
+// (perf_event_paranoid > 1) still catch page faults, but never see a context switch or migration; that
+// too is warned about and reported. Returns the mode in effect.
+int perturb_open(struct perturb *p, const char *mode, int cpu);
+void perturb_close(struct perturb *p);
+
+const char *perturb_signal_name(enum perturb_signal s);
+
+void perturb_read(struct perturb *p, struct perturb_counts *c);
+
+// Call right before the trial
+static inline void perturb_begin(struct perturb *p, struct perturb_counts *start)
+{
+    if (p->mode)
+        perturb_read(p, start);
+}
+
+// Call right after the trial; nonzero when the trial should be dropped
+int perturb_end(struct perturb *p, const struct perturb_counts *start);
+
+// Call before each attempt at a trial, with attempts starting at 0; nonzero once max attempts have been
+// made, so that a point whose every trial is perturbed still ends. Warns each time it stops a point.
+int perturb_give_up(struct perturb *p, long *attempts, long max);
+
+void perturb_report(const struct perturb *p, FILE *out);
+
+#endif
@@ -0,0 +1,146 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "pmu.h"
+
+#define BASELINE_READS 1000
+
+static const uint64_t event_configs[PMU_NUM_EVENTS] = {
+    [PMU_BRANCH_MISSES] = PERF_COUNT_HW_BRANCH_MISSES,
+    [PMU_BRANCHES] = PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+    [PMU_CYCLES] = PERF_COUNT_HW_CPU_CYCLES,
+    [PMU_INSTRUCTIONS] = PERF_COUNT_HW_INSTRUCTIONS,
+};
+
+static const char *event_names[PMU_NUM_EVENTS] = {
+    [PMU_BRANCH_MISSES] = "branch-misses",
+    [PMU_BRANCHES] = "branches",
+    [PMU_CYCLES] = "cycles",
+    [PMU_INSTRUCTIONS] = "instructions",
+};
+
+const char *pmu_event_name(enum pmu_event e)
+{
+    return e < PMU_NUM_EVENTS ? event_names[e] : "unknown";
+}
+
+static int open_event(uint64_t config, int group_fd)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // On arm64 config1 bit 0 asks for a 64-bit counter and bit 1 for user access (Linux 5.17+)
+#if defined(__aarch64__)
+    attr.config1 = 0x3;
+    int fd = syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+    if (fd >= 0)
+        return fd;
+    attr.config1 = 0;
+#endif
+    return syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+int pmu_open(struct pmu *p)
+{
+    long page = sysconf(_SC_PAGESIZE);
+
+    memset(p, 0, sizeof(*p));
+    for (int i = 0; i < PMU_NUM_EVENTS; i++)
+        p->fds[i] = -1;
+
+    for (int i = 0; i < PMU_NUM_EVENTS; i++)
+    {
+        p->fds[i] = open_event(event_configs[i], i == 0 ? -1 : p->fds[0]);
+        if (p->fds[i] < 0)
+        {
+            pmu_close(p);
+            return -1;
+        }
+    }
+
+    ioctl(p->fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+    // Self-monitoring pages; user reads need every counter to be published
+    p->user_read = 1;
+    for (int i = 0; i < PMU_NUM_EVENTS; i++)
+    {
+        void *pc = mmap(NULL, page, PROT_READ, MAP_SHARED, p->fds[i], 0);
+        if (pc == MAP_FAILED)
+        {
+            p->user_read = 0;
+            continue;
+        }
+        p->pc[i] = pc;
+        if (!p->pc[i]->cap_user_rdpmc || p->pc[i]->index == 0)
+            p->user_read = 0;
+    }
+    if (p->user_read)
+    {
+        p->miss_counter = p->pc[PMU_BRANCH_MISSES]->index - 1;
+        p->miss_shift = 64 - p->pc[PMU_BRANCH_MISSES]->pmc_width;
+    }
+
+    // The reads themselves retire instructions and branches; keep the cheapest empty region
+    struct pmu_counts start, end;
+    memset(&p->baseline, 0xff, sizeof(p->baseline));
+    for (int n = 0; n < BASELINE_READS; n++)
+    {
+        pmu_read(p, &start);
+        pmu_read(p, &end);
+        for (int i = 0; i < PMU_NUM_EVENTS; i++)
+            if (end.v[i] - start.v[i] < p->baseline.v[i])
+                p->baseline.v[i] = end.v[i] - start.v[i];
+    }
+
+    return 0;
+}
+
+void pmu_read_syscall(const struct pmu *p, struct pmu_counts *c)
+{
+    uint64_t buf[1 + PMU_NUM_EVENTS]; // nr followed by one value per event
+
+    if (read(p->fds[0], buf, sizeof(buf)) != sizeof(buf))
+    {
+        memset(c, 0, sizeof(*c));
+        return;
+    }
+    for (int i = 0; i < PMU_NUM_EVENTS; i++)
+        c->v[i] = buf[1 + i];
+}
+
+void pmu_delta(const struct pmu *p, const struct pmu_counts *start, const struct pmu_counts *end,
+               struct pmu_counts *out)
+{
+    for (int i = 0; i < PMU_NUM_EVENTS; i++)
+    {
+        uint64_t d = end->v[i] - start->v[i];
+        out->v[i] = d > p->baseline.v[i] ? d - p->baseline.v[i] : 0;
+    }
+}
+
+void pmu_close(struct pmu *p)
+{
+    long page = sysconf(_SC_PAGESIZE);
+
+    for (int i = PMU_NUM_EVENTS - 1; i >= 0; i--)
+    {
+        if (p->pc[i])
+            munmap((void *)p->pc[i], page);
+        if (p->fds[i] >= 0)
+            close(p->fds[i]);
+        p->pc[i] = NULL;
+        p->fds[i] = -1;
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef PMU_H
+#define PMU_H
+
+#include <linux/perf_event.h>
+#include <stdint.h>
+
+#include "timer.h"
+
+// Events counted together in one perf_event group
+enum pmu_event
+{
+    PMU_BRANCH_MISSES,
+    PMU_BRANCHES,
+    PMU_CYCLES,
+    PMU_INSTRUCTIONS,
+    PMU_NUM_EVENTS,
+};
+
+struct pmu_counts
+{
+    uint64_t v[PMU_NUM_EVENTS];
+};
+
+struct pmu
+{
+    int fds[PMU_NUM_EVENTS];                             // fds[0] leads the group
+    volatile struct perf_event_mmap_page *pc[PMU_NUM_EVENTS];
+    int user_read;                                       // Every counter can be read without a syscall
+    struct pmu_counts baseline;                          // Counts of an empty region, removed by pmu_delta
+    uint32_t miss_counter;                               // Hardware counter of PMU_BRANCH_MISSES, for pmu_read_misses
+    int miss_shift;                                      // 64 - its width
+};
+
+// Open the group for the calling thread; returns -1 if the PMU is not exposed
+int pmu_open(struct pmu *p);
+void pmu_close(struct pmu *p);
+
+const char *pmu_event_name(enum pmu_event e);
+
+// Group read through the leader fd, used when user-space reads are not allowed
+void pmu_read_syscall(const struct pmu *p, struct pmu_counts *c);
+
+__attribute__((always_inline)) static inline void pmu_read(const struct pmu *p, struct pmu_counts *c)
+{
+    if (!p->user_read)
+    {
+        pmu_read_syscall(p, c);
+        return;
+    }
+
+    timer_fence();
+    for (int i = 0; i < PMU_NUM_EVENTS; i++)
+        c->v[i] = timer_read_perf(p->pc[i]);
+    timer_fence();
+}
+
+// Branch misses so far, without a branch of its own, so that it can sit between the branches of a
+// measurement without shifting their history: the counter is the one pmu_open found and the seqlock is not
+// retried, so trials the counter was rescheduled in have to be dropped (see perturb.h). Needs user_read.
+__attribute__((always_inline)) static inline uint64_t pmu_read_misses(const struct pmu *p)
+{
+    uint64_t pmc = 0;
+
+    timer_fence();
+#if defined(__aarch64__)
+    // PMSELR_EL0 picks the event counter, so no switch over the counter registers as in timer_read_pmc
+    asm volatile("msr pmselr_el0, %1\n\tisb\n\tmrs %0, pmxevcntr_el0" : "=r"(pmc) : "r"((uint64_t)p->miss_counter));
+#elif defined(__x86_64__) || defined(__i386__)
+    pmc = timer_read_pmc(p->miss_counter);
+#endif
+    timer_fence();
+    return p->pc[PMU_BRANCH_MISSES]->offset + (uint64_t)((int64_t)(pmc << p->miss_shift) >> p->miss_shift);
+}
+
+// end - start with the cost of the reads themselves taken out
+void pmu_delta(const struct pmu *p, const struct pmu_counts *start, const struct pmu_counts *end,
+               struct pmu_counts *out);
+
+#endif
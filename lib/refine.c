@@ -0,0 +1,233 @@
+#include <err.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "refine.h"
+
+// Callbacks of the caller, reached through the ctx of the sweep pool
+struct round
+{
+    struct refine *r;
+    void (*setup)(int cpu, void *ctx);
+    void (*run)(int cell, void *ctx);
+    void (*teardown)(void *ctx);
+    void *ctx;
+};
+
+// value and ci as doubles, then cells
+static size_t shared_size(int num_cells)
+{
+    return 2 * num_cells * sizeof(double) + num_cells * sizeof(int);
+}
+
+void refine_init(struct refine *r, double threshold)
+{
+    memset(r, 0, sizeof(*r));
+    r->threshold = threshold;
+}
+
+void refine_axis(struct refine *r, const char *name, const int *values, int num)
+{
+    if (r->num_axes == REFINE_MAX_AXES)
+        errx(EXIT_FAILURE, "Too many sweep axes");
+    r->axes[r->num_axes].name = name;
+    r->axes[r->num_axes].values = values;
+    r->axes[r->num_axes].num = num;
+    r->num_axes++;
+}
+
+void refine_record(struct refine *r, int cell, double value, double ci)
+{
+    r->value[cell] = value;
+    r->ci[cell] = ci;
+}
+
+// Distance between neighbouring cells along axis k
+static int axis_step(const struct refine *r, int k)
+{
+    int step = 1;
+
+    for (int j = k + 1; j < r->num_axes; j++)
+        step *= r->axes[j].num;
+    return step;
+}
+
+static int axis_index(const struct refine *r, int cell, int k)
+{
+    return cell / axis_step(r, k) % r->axes[k].num;
+}
+
+// A step is a difference both beyond the noise of the two cells and larger than threshold relative to them
+static int significant(const struct refine *r, int a, int b)
+{
+    double va = r->value[a], vb = r->value[b];
+    double d = fabs(va - vb);
+
+    if (!isfinite(d))
+        return 0;
+    return d > sqrt(r->ci[a] * r->ci[a] + r->ci[b] * r->ci[b]) && d > r->threshold * fmax(fabs(va), fabs(vb));
+}
+
+// First pass: every REFINE_COARSE-th part of each axis and its last value, or everything with no threshold
+static int coarse_cells(struct refine *r)
+{
+    int n = 0;
+
+    for (int cell = 0; cell < r->num_cells; cell++)
+    {
+        int keep = 1;
+
+        for (int k = 0; k < r->num_axes && keep; k++)
+        {
+            int num = r->axes[k].num, i = axis_index(r, cell, k);
+            int stride = r->threshold > 0 ? (num - 1 + REFINE_COARSE - 2) / (REFINE_COARSE - 1) : 1;
+
+            keep = stride < 1 || i % stride == 0 || i == num - 1;
+        }
+        if (keep)
+            r->cells[n++] = cell;
+    }
+    return n;
+}
+
+// Midpoints between measured neighbours with a step between them, along every line of every axis
+static int bisect_cells(struct refine *r)
+{
+    int n = 0;
+
+    for (int k = 0; k < r->num_axes; k++)
+    {
+        int step = axis_step(r, k), num = r->axes[k].num;
+
+        for (int start = 0; start < r->num_cells; start++)
+        {
+            if (axis_index(r, start, k) != 0)
+                continue;
+
+            int prev = -1;
+            for (int i = 0; i < num; i++)
+            {
+                if (isnan(r->value[start + i * step]))
+                    continue;
+                if (prev >= 0 && i - prev > 1 && significant(r, start + prev * step, start + i * step))
+                {
+                    int mid = start + (prev + i) / 2 * step;
+                    int queued = 0;
+
+                    for (int j = 0; j < n && !queued; j++)
+                        queued = r->cells[j] == mid;
+                    if (!queued)
+                        r->cells[n++] = mid;
+                }
+                prev = i;
+            }
+        }
+    }
+    return n;
+}
+
+static void round_setup(int cpu, void *ctx)
+{
+    struct round *rd = ctx;
+
+    if (rd->setup)
+        rd->setup(cpu, rd->ctx);
+}
+
+static void round_run(int point, void *ctx)
+{
+    struct round *rd = ctx;
+
+    rd->run(rd->r->cells[point], rd->ctx);
+}
+
+static void round_teardown(void *ctx)
+{
+    struct round *rd = ctx;
+
+    if (rd->teardown)
+        rd->teardown(rd->ctx);
+}
+
+void refine_run(struct refine *r, const struct sweep *s, void (*setup)(int cpu, void *ctx),
+                void (*run)(int cell, void *ctx), void (*teardown)(void *ctx), void *ctx)
+{
+    struct round rd = {r, setup, run, teardown, ctx};
+
+    r->num_cells = 1;
+    for (int k = 0; k < r->num_axes; k++)
+        r->num_cells *= r->axes[k].num;
+
+    // Workers are set up once, so every round shares their calibration; the cells of each round go to
+    // them and the results come back through a shared mapping
+    r->value = mmap(NULL, shared_size(r->num_cells), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (r->value == MAP_FAILED)
+        err(EXIT_FAILURE, "Unable to map the sweep results");
+    r->ci = r->value + r->num_cells;
+    r->cells = (int *)(r->ci + r->num_cells);
+    for (int cell = 0; cell < r->num_cells; cell++)
+        r->value[cell] = NAN;
+
+    struct sweep_pool pool;
+    sweep_pool_start(&pool, s, r->num_cells, round_setup, round_run, round_teardown, &rd);
+    int n = coarse_cells(r);
+    while (n > 0)
+    {
+        if (r->threshold > 0)
+            printf("Refinement round %d: %d points\n", r->num_rounds, n);
+        sweep_pool_run(&pool, n);
+        r->num_rounds++;
+        r->num_measured += n;
+        n = r->threshold > 0 ? bisect_cells(r) : 0;
+    }
+    sweep_pool_finish(&pool);
+}
+
+void refine_report(const struct refine *r, FILE *out)
+{
+    if (r->threshold <= 0)
+        return;
+
+    fprintf(out, "Refinement: %d of %d points measured in %d rounds\n", r->num_measured, r->num_cells,
+            r->num_rounds);
+    for (int k = 0; k < r->num_axes; k++)
+    {
+        int step = axis_step(r, k), num = r->axes[k].num;
+
+        for (int start = 0; start < r->num_cells; start++)
+        {
+            if (axis_index(r, start, k) != 0)
+                continue;
+
+            int prev = -1;
+            for (int i = 0; i < num; i++)
+            {
+                int cell = start + i * step;
+
+                if (isnan(r->value[cell]))
+                    continue;
+                if (prev == i - 1 && prev >= 0 && significant(r, start + prev * step, cell))
+                {
+                    fprintf(out, "Step at %s %d -> %d", r->axes[k].name, r->axes[k].values[prev],
+                            r->axes[k].values[i]);
+                    for (int j = 0; j < r->num_axes; j++)
+                        if (j != k)
+                            fprintf(out, ", %s %d", r->axes[j].name, r->axes[j].values[axis_index(r, cell, j)]);
+                    fprintf(out, ": %f -> %f\n", r->value[start + prev * step], r->value[cell]);
+                }
+                prev = i;
+            }
+        }
+    }
+}
+
+void refine_free(struct refine *r)
+{
+    if (r->value)
+        munmap(r->value, shared_size(r->num_cells));
+    r->value = r->ci = NULL;
+    r->cells = NULL;
+}
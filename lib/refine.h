@@ -0,0 +1,55 @@
+#ifndef REFINE_H
+#define REFINE_H
+
+#include <stdio.h>
+
+#include "workers.h"
+
+#define REFINE_MAX_AXES 2
+#define REFINE_COARSE 5 // Values per axis in the first pass
+
+struct refine_axis
+{
+    const char *name;
+    const int *values; // Candidates in sweep order
+    int num;
+};
+
+// Sweep that measures a coarse grid first and then bisects between neighbouring points whose results
+// differ, so a latency step is located in a logarithmic number of points instead of by measuring every
+// candidate. Points are cells of the grid of axis values, the last axis varying fastest: with two
+// axes cell = i0 * axes[1].num + i1. Neighbours are compared along every axis within one row or
+// column of the grid.
+struct refine
+{
+    struct refine_axis axes[REFINE_MAX_AXES];
+    int num_axes;
+    int num_cells;
+    double threshold; // Relative difference that counts as a step; 0 measures every cell
+    double *value;    // Per cell, shared with the workers; NAN until measured
+    double *ci;       // Half-width of the confidence interval of value, 0 if unknown
+    int *cells;       // Cells measured in the current round, shared with the workers
+    int num_rounds, num_measured;
+};
+
+void refine_init(struct refine *r, double threshold);
+
+// Add an axis; values must stay valid until refine_free
+void refine_axis(struct refine *r, const char *name, const int *values, int num);
+
+// Result of a cell, called by run from whichever worker measured it
+void refine_record(struct refine *r, int cell, double value, double ci);
+
+// Measure in rounds until no neighbours with a step between them have an unmeasured candidate in
+// between. The workers of s are set up once and given the new cells of every round (see sweep_pool), so
+// all rounds are measured against the same calibration; run gets cells, not round indices, and has to
+// refine_record each one.
+void refine_run(struct refine *r, const struct sweep *s, void (*setup)(int cpu, void *ctx),
+                void (*run)(int cell, void *ctx), void (*teardown)(void *ctx), void *ctx);
+
+// Steps that were narrowed down to adjacent candidates
+void refine_report(const struct refine *r, FILE *out);
+
+void refine_free(struct refine *r);
+
+#endif
@@ -0,0 +1,368 @@
+// Binary layout (SINK_BIN), all integers little-endian:
+//   "BPCOL\0\1\0"                                 magic and version
+//   u32 num_meta, then per entry: str key, str value   (str = u32 length + bytes)
+//   u32 num_columns, then per column: u32 type, str name
+//   blocks until EOF: u32 rows, then for each column `rows` 8-byte values (int64 or IEEE double)
+// Blocks are self-contained, so blocks appended by different workers may follow each other in any order.
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/utsname.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sink.h"
+
+#define SINK_LINE_LEN 65536
+
+static const char bin_magic[8] = {'B', 'P', 'C', 'O', 'L', 0, 1, 0};
+
+static void write_all(struct sink *s, const void *buf, size_t len)
+{
+    if (write(s->fd, buf, len) != (ssize_t)len)
+    {
+        perror("Unable to write results");
+        exit(EXIT_FAILURE);
+    }
+}
+
+void sink_open(struct sink *s, const char *path, const char *format)
+{
+    memset(s, 0, sizeof(*s));
+    s->fd = -1;
+    if (!path)
+        return;
+
+    if (!format)
+    {
+        format = strrchr(path, '.');
+        format = format ? format + 1 : "csv";
+    }
+    if (strcmp(format, "csv") == 0)
+        s->format = SINK_CSV;
+    else if (strcmp(format, "jsonl") == 0 || strcmp(format, "json") == 0)
+        s->format = SINK_JSONL;
+    else if (strcmp(format, "bin") == 0)
+        s->format = SINK_BIN;
+    else
+    {
+        fprintf(stderr, "Unknown result format %s (expected csv, jsonl or bin)\n", format);
+        exit(EXIT_FAILURE);
+    }
+
+    s->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+    if (s->fd < 0)
+    {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+}
+
+int sink_column(struct sink *s, const char *name, enum sink_type type)
+{
+    if (s->num_columns == SINK_MAX_COLUMNS)
+    {
+        fprintf(stderr, "Too many result columns\n");
+        exit(EXIT_FAILURE);
+    }
+    snprintf(s->columns[s->num_columns].name, SINK_NAME_LEN, "%s", name);
+    s->columns[s->num_columns].type = type;
+    return s->num_columns++;
+}
+
+void sink_meta(struct sink *s, const char *key, const char *fmt, ...)
+{
+    va_list ap;
+
+    if (s->num_meta == SINK_MAX_META)
+        return;
+    snprintf(s->meta[s->num_meta].key, SINK_NAME_LEN, "%s", key);
+    va_start(ap, fmt);
+    vsnprintf(s->meta[s->num_meta].value, SINK_VALUE_LEN, fmt, ap);
+    va_end(ap);
+    s->num_meta++;
+}
+
+// First line of path, without the newline, or "unknown"
+static void read_line(const char *path, char *buf, size_t size)
+{
+    FILE *f = fopen(path, "r");
+
+    snprintf(buf, size, "unknown");
+    if (!f)
+        return;
+    if (fgets(buf, size, f))
+        buf[strcspn(buf, "\n")] = '\0';
+    fclose(f);
+}
+
+// Raspberry Pi kernels name the board in "Model"; x86 has "model name"; other arm64 only the part numbers
+static void cpu_model(char *buf, size_t size)
+{
+    static const char *keys[] = {"Model", "model name", "Hardware", "CPU part"};
+    char line[512];
+    FILE *f = fopen("/proc/cpuinfo", "r");
+
+    snprintf(buf, size, "unknown");
+    if (!f)
+        return;
+    for (size_t k = 0; k < sizeof(keys) / sizeof(keys[0]); k++)
+    {
+        rewind(f);
+        while (fgets(line, sizeof(line), f))
+        {
+            char *colon = strchr(line, ':');
+            size_t len = strlen(keys[k]);
+
+            if (!colon || strncmp(line, keys[k], len) != 0 || (line[len] != ' ' && line[len] != '\t'))
+                continue;
+            colon++;
+            while (*colon == ' ')
+                colon++;
+            colon[strcspn(colon, "\n")] = '\0';
+            snprintf(buf, size, "%s", colon);
+            fclose(f);
+            return;
+        }
+    }
+    fclose(f);
+}
+
+void sink_meta_system(struct sink *s, int cpu, int argc, char **argv)
+{
+    char buf[SINK_VALUE_LEN], path[128];
+    struct utsname uts;
+    time_t now = time(NULL);
+    size_t len = 0;
+
+    buf[0] = '\0';
+    for (int i = 0; i < argc && len < sizeof(buf); i++)
+        len += snprintf(buf + len, sizeof(buf) - len, i ? " %s" : "%s", argv[i]);
+    sink_meta(s, "command", "%s", buf);
+
+    gethostname(buf, sizeof(buf));
+    buf[sizeof(buf) - 1] = '\0';
+    sink_meta(s, "host", "%s", buf);
+    sink_meta(s, "run", "%s-%ld-%d", buf, (long)now, (int)getpid());
+
+    if (uname(&uts) == 0)
+        sink_meta(s, "kernel", "%s %s %s %s", uts.sysname, uts.release, uts.version, uts.machine);
+
+    cpu_model(buf, sizeof(buf));
+    sink_meta(s, "cpu_model", "%s", buf);
+
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_governor", cpu);
+    read_line(path, buf, sizeof(buf));
+    sink_meta(s, "governor", "%s", buf);
+
+    strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S%z", localtime(&now));
+    sink_meta(s, "start", "%s", buf);
+}
+
+// Append str to buf as a JSON string literal
+static size_t json_string(char *buf, size_t size, size_t len, const char *str)
+{
+    if (len < size)
+        buf[len++] = '"';
+    for (; *str && len + 7 < size; str++)
+    {
+        unsigned char c = *str;
+
+        if (c == '"' || c == '\\')
+            len += snprintf(buf + len, size - len, "\\%c", c);
+        else if (c < 0x20)
+            len += snprintf(buf + len, size - len, "\\u%04x", c);
+        else
+            buf[len++] = c;
+    }
+    if (len < size)
+        buf[len++] = '"';
+    return len;
+}
+
+static void put_u32(unsigned char **p, uint32_t v)
+{
+    for (int i = 0; i < 4; i++)
+        *(*p)++ = v >> (8 * i);
+}
+
+static void put_u64(unsigned char **p, uint64_t v)
+{
+    for (int i = 0; i < 8; i++)
+        *(*p)++ = v >> (8 * i);
+}
+
+static void put_str(unsigned char **p, const char *str)
+{
+    size_t len = strlen(str);
+
+    put_u32(p, len);
+    memcpy(*p, str, len);
+    *p += len;
+}
+
+void sink_start(struct sink *s)
+{
+    static char buf[SINK_LINE_LEN];
+    size_t len = 0;
+
+    if (s->format == SINK_NONE || s->started)
+        return;
+    s->started = 1;
+
+    switch (s->format)
+    {
+    case SINK_CSV:
+        for (int i = 0; i < s->num_meta; i++)
+            len += snprintf(buf + len, sizeof(buf) - len, "# %s: %s\n", s->meta[i].key, s->meta[i].value);
+        for (int c = 0; c < s->num_columns; c++)
+            len += snprintf(buf + len, sizeof(buf) - len, c ? ",%s" : "%s", s->columns[c].name);
+        len += snprintf(buf + len, sizeof(buf) - len, "\n");
+        break;
+
+    case SINK_JSONL:
+        len += snprintf(buf, sizeof(buf), "{\"meta\": {");
+        for (int i = 0; i < s->num_meta; i++)
+        {
+            if (i)
+                len += snprintf(buf + len, sizeof(buf) - len, ", ");
+            len = json_string(buf, sizeof(buf), len, s->meta[i].key);
+            len += snprintf(buf + len, sizeof(buf) - len, ": ");
+            len = json_string(buf, sizeof(buf), len, s->meta[i].value);
+        }
+        len += snprintf(buf + len, sizeof(buf) - len, "}}\n");
+        break;
+
+    case SINK_BIN:
+    {
+        unsigned char *p = (unsigned char *)buf;
+
+        memcpy(p, bin_magic, sizeof(bin_magic));
+        p += sizeof(bin_magic);
+        put_u32(&p, s->num_meta);
+        for (int i = 0; i < s->num_meta; i++)
+        {
+            put_str(&p, s->meta[i].key);
+            put_str(&p, s->meta[i].value);
+        }
+        put_u32(&p, s->num_columns);
+        for (int c = 0; c < s->num_columns; c++)
+        {
+            put_u32(&p, s->columns[c].type);
+            put_str(&p, s->columns[c].name);
+        }
+        len = p - (unsigned char *)buf;
+
+        s->block = malloc(sizeof(*s->block) * SINK_BLOCK_ROWS * s->num_columns);
+        break;
+    }
+
+    case SINK_NONE:
+        break;
+    }
+
+    if (len > sizeof(buf))
+        len = sizeof(buf);
+    write_all(s, buf, len);
+}
+
+static const char *run_id(const struct sink *s)
+{
+    for (int i = 0; i < s->num_meta; i++)
+        if (strcmp(s->meta[i].key, "run") == 0)
+            return s->meta[i].value;
+    return "";
+}
+
+void sink_emit(struct sink *s)
+{
+    char buf[SINK_LINE_LEN];
+    size_t len = 0;
+
+    if (s->format == SINK_NONE)
+        return;
+    if (!s->started)
+        sink_start(s);
+
+    switch (s->format)
+    {
+    case SINK_CSV:
+        for (int c = 0; c < s->num_columns; c++)
+        {
+            if (c)
+                buf[len++] = ',';
+            if (s->columns[c].type == SINK_INT)
+                len += snprintf(buf + len, sizeof(buf) - len, "%lld", (long long)s->row[c].i);
+            else
+                len += snprintf(buf + len, sizeof(buf) - len, "%.9g", s->row[c].f);
+        }
+        buf[len++] = '\n';
+        write_all(s, buf, len);
+        break;
+
+    case SINK_JSONL:
+        len += snprintf(buf, sizeof(buf), "{\"run\": ");
+        len = json_string(buf, sizeof(buf), len, run_id(s));
+        for (int c = 0; c < s->num_columns; c++)
+        {
+            len += snprintf(buf + len, sizeof(buf) - len, ", ");
+            len = json_string(buf, sizeof(buf), len, s->columns[c].name);
+            if (s->columns[c].type == SINK_INT)
+                len += snprintf(buf + len, sizeof(buf) - len, ": %lld", (long long)s->row[c].i);
+            else if (!isfinite(s->row[c].f)) // JSON has no NaN or infinity
+                len += snprintf(buf + len, sizeof(buf) - len, ": null");
+            else
+                len += snprintf(buf + len, sizeof(buf) - len, ": %.9g", s->row[c].f);
+        }
+        len += snprintf(buf + len, sizeof(buf) - len, "}\n");
+        write_all(s, buf, len);
+        break;
+
+    case SINK_BIN:
+        for (int c = 0; c < s->num_columns; c++)
+            s->block[c * SINK_BLOCK_ROWS + s->block_rows] = s->row[c];
+        if (++s->block_rows == SINK_BLOCK_ROWS)
+            sink_flush(s);
+        break;
+
+    case SINK_NONE:
+        break;
+    }
+}
+
+void sink_flush(struct sink *s)
+{
+    if (s->format != SINK_BIN || !s->block_rows)
+        return;
+
+    size_t size = 4 + (size_t)s->num_columns * s->block_rows * 8;
+    unsigned char *buf = malloc(size), *p = buf;
+
+    put_u32(&p, s->block_rows);
+    for (int c = 0; c < s->num_columns; c++)
+        for (int r = 0; r < s->block_rows; r++)
+            put_u64(&p, s->block[c * SINK_BLOCK_ROWS + r].i);
+    write_all(s, buf, size);
+    free(buf);
+    s->block_rows = 0;
+}
+
+void sink_close(struct sink *s)
+{
+    if (s->format == SINK_NONE)
+        return;
+    if (!s->started)
+        sink_start(s);
+    sink_flush(s);
+    free(s->block);
+    s->block = NULL;
+    close(s->fd);
+    s->fd = -1;
+    s->format = SINK_NONE;
+}
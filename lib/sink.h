@@ -0,0 +1,96 @@
+#ifndef SINK_H
+#define SINK_H
+
+#include <stdint.h>
+
+#define SINK_MAX_COLUMNS 32
+#define SINK_MAX_META 48
+#define SINK_NAME_LEN 64
+#define SINK_VALUE_LEN 512
+#define SINK_BLOCK_ROWS 4096 // Rows buffered per block of the binary format
+
+// Where records go. SINK_NONE turns every call into a no-op so experiments can record unconditionally.
+enum sink_format
+{
+    SINK_NONE,
+    SINK_CSV,   // Metadata as leading "# key: value" lines, then a header row
+    SINK_JSONL, // One {"meta": {...}} line, then one object per record carrying the run id
+    SINK_BIN,   // Columnar blocks, see sink.c
+};
+
+enum sink_type
+{
+    SINK_INT,
+    SINK_FLOAT,
+};
+
+union sink_value
+{
+    int64_t i;
+    double f;
+};
+
+struct sink_column
+{
+    char name[SINK_NAME_LEN];
+    enum sink_type type;
+};
+
+struct sink_meta
+{
+    char key[SINK_NAME_LEN];
+    char value[SINK_VALUE_LEN];
+};
+
+// Records are written with O_APPEND and one write() per row (per block for SINK_BIN), so worker
+// processes forked after sink_start can share the sink: rows from different workers never interleave.
+// Workers must sink_flush before they exit.
+struct sink
+{
+    enum sink_format format;
+    int fd;
+    struct sink_column columns[SINK_MAX_COLUMNS];
+    int num_columns;
+    struct sink_meta meta[SINK_MAX_META];
+    int num_meta;
+    union sink_value row[SINK_MAX_COLUMNS];
+    union sink_value *block; // SINK_BIN: SINK_BLOCK_ROWS rows, column major
+    int block_rows;
+    int started;
+};
+
+// Open path for writing; format is "csv", "jsonl" or "bin", or NULL to go by the extension of path.
+// A NULL path gives a SINK_NONE sink. Exits on failure.
+void sink_open(struct sink *s, const char *path, const char *format);
+
+// Declare a column before sink_start; returns its index
+int sink_column(struct sink *s, const char *name, enum sink_type type);
+
+// Add a metadata entry before sink_start
+void sink_meta(struct sink *s, const char *key, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+// Command line, host, kernel, CPU model, frequency governor of cpu, start time and run id
+void sink_meta_system(struct sink *s, int cpu, int argc, char **argv);
+
+// Write the header; columns and metadata are fixed from here on
+void sink_start(struct sink *s);
+
+static inline void sink_int(struct sink *s, int col, int64_t v)
+{
+    s->row[col].i = v;
+}
+
+static inline void sink_float(struct sink *s, int col, double v)
+{
+    s->row[col].f = v;
+}
+
+// Write the current row
+void sink_emit(struct sink *s);
+
+// Write out buffered binary rows
+void sink_flush(struct sink *s);
+
+void sink_close(struct sink *s);
+
+#endif
@@ -0,0 +1,128 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "spec.h"
+
+void spec_init(struct spec *s)
+{
+    memset(s, 0, sizeof(*s));
+}
+
+// Strip leading and trailing white space in place
+static char *trim(char *str)
+{
+    char *end;
+
+    while (isspace((unsigned char)*str))
+        str++;
+    end = str + strlen(str);
+    while (end > str && isspace((unsigned char)end[-1]))
+        *--end = '\0';
+    return str;
+}
+
+int spec_set(struct spec *s, const char *assignment, const char *origin, int line)
+{
+    char buf[SPEC_KEY_LEN + SPEC_VALUE_LEN];
+    char *eq, *key, *value;
+    struct spec_entry *e = NULL;
+
+    snprintf(buf, sizeof(buf), "%s", assignment);
+    eq = strchr(buf, '=');
+    if (!eq)
+        return -1;
+    *eq = '\0';
+    key = trim(buf);
+    value = trim(eq + 1);
+    if (!*key || strlen(key) >= SPEC_KEY_LEN || strlen(value) >= SPEC_VALUE_LEN)
+        return -1;
+
+    for (int i = 0; i < s->num_entries; i++)
+        if (strcmp(s->entries[i].key, key) == 0)
+            e = &s->entries[i];
+
+    if (!e)
+    {
+        if (s->num_entries == SPEC_MAX_ENTRIES)
+        {
+            fprintf(stderr, "%s:%d: too many entries\n", origin, line);
+            exit(EXIT_FAILURE);
+        }
+        e = &s->entries[s->num_entries++];
+        strcpy(e->key, key);
+    }
+    strcpy(e->value, value);
+    e->origin = origin;
+    e->line = line;
+    return 0;
+}
+
+void spec_load(struct spec *s, const char *path)
+{
+    char line[SPEC_KEY_LEN + SPEC_VALUE_LEN + 64];
+    int lineno = 0;
+
+    FILE *f = fopen(path, "r");
+    if (!f)
+    {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+
+    while (fgets(line, sizeof(line), f))
+    {
+        lineno++;
+        line[strcspn(line, "#")] = '\0';
+        if (!*trim(line))
+            continue;
+
+        if (spec_set(s, line, path, lineno) < 0)
+        {
+            fprintf(stderr, "%s:%d: expected key = value\n", path, lineno);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    fclose(f);
+}
+
+const char *spec_get(struct spec *s, const char *key)
+{
+    for (int i = 0; i < s->num_entries; i++)
+    {
+        if (strcmp(s->entries[i].key, key) == 0)
+        {
+            s->entries[i].used = 1;
+            return s->entries[i].value;
+        }
+    }
+    return NULL;
+}
+
+int spec_get_bool(struct spec *s, const char *key, int def)
+{
+    const char *v = spec_get(s, key);
+
+    if (!v)
+        return def;
+    return strcmp(v, "1") == 0 || strcasecmp(v, "yes") == 0 || strcasecmp(v, "true") == 0 ||
+           strcasecmp(v, "on") == 0;
+}
+
+int spec_report_unused(const struct spec *s, FILE *out)
+{
+    int unused = 0;
+
+    for (int i = 0; i < s->num_entries; i++)
+    {
+        if (!s->entries[i].used)
+        {
+            fprintf(out, "%s:%d: unknown key '%s'\n", s->entries[i].origin, s->entries[i].line, s->entries[i].key);
+            unused++;
+        }
+    }
+    return unused;
+}
@@ -0,0 +1,45 @@
+#ifndef SPEC_H
+#define SPEC_H
+
+#include <stdio.h>
+
+#define SPEC_MAX_ENTRIES 128
+#define SPEC_KEY_LEN 64
+#define SPEC_VALUE_LEN 256
+
+// One `key = value` line of an experiment spec
+struct spec_entry
+{
+    char key[SPEC_KEY_LEN];
+    char value[SPEC_VALUE_LEN];
+    const char *origin; // File the entry came from, or "command line"
+    int line;
+    int used;           // Looked up by the consumer; entries never looked up are reported as unknown
+};
+
+// Flat key/value experiment description. Blank lines and text after '#' are ignored; a later
+// assignment to the same key replaces the earlier one.
+struct spec
+{
+    struct spec_entry entries[SPEC_MAX_ENTRIES];
+    int num_entries;
+};
+
+void spec_init(struct spec *s);
+
+// Read every line of path into s; exits with file:line on a malformed line
+void spec_load(struct spec *s, const char *path);
+
+// Apply one `key=value` override; returns -1 if assignment has no '='
+int spec_set(struct spec *s, const char *assignment, const char *origin, int line);
+
+// Value of key, or NULL; marks the entry used
+const char *spec_get(struct spec *s, const char *key);
+
+// Value of key as a boolean (1/yes/true/on); def when absent
+int spec_get_bool(struct spec *s, const char *key, int def);
+
+// Print every entry that was never looked up; returns how many there were
+int spec_report_unused(const struct spec *s, FILE *out);
+
+#endif
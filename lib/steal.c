@@ -0,0 +1,158 @@
+#include <err.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "bpure.h"
+#include "steal.h"
+
+// Shared between the parent and all workers
+struct shares
+{
+    _Atomic uint64_t range[SWEEP_MAX_WORKERS]; // end << 32 | next
+    atomic_long steals;
+};
+
+static uint64_t pack(uint32_t next, uint32_t end)
+{
+    return (uint64_t)end << 32 | next;
+}
+
+static uint32_t next_of(uint64_t range)
+{
+    return (uint32_t)range;
+}
+
+static uint32_t end_of(uint64_t range)
+{
+    return range >> 32;
+}
+
+// Claim the front item of worker w's own share
+static int take(struct shares *sh, int w, long *item)
+{
+    uint64_t range = atomic_load(&sh->range[w]);
+
+    while (next_of(range) < end_of(range))
+    {
+        if (atomic_compare_exchange_weak(&sh->range[w], &range, pack(next_of(range) + 1, end_of(range))))
+        {
+            *item = next_of(range);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Move the back half of the largest other share to w's own, which is empty. Only its owner refills a
+// share, and every item is in one share at a time, so a share never comes back to a value a thief saw.
+static int steal(struct shares *sh, int num_workers, int w)
+{
+    for (;;)
+    {
+        int victim = -1;
+        uint32_t most = 0;
+        uint64_t seen = 0;
+
+        for (int v = 0; v < num_workers; v++)
+        {
+            uint64_t range = atomic_load(&sh->range[v]);
+            uint32_t left = end_of(range) - next_of(range);
+
+            if (v != w && next_of(range) < end_of(range) && left > most)
+            {
+                victim = v;
+                most = left;
+                seen = range;
+            }
+        }
+        if (victim < 0)
+            return 0;
+
+        uint32_t mid = next_of(seen) + most / 2;
+        if (atomic_compare_exchange_strong(&sh->range[victim], &seen, pack(next_of(seen), mid)))
+        {
+            atomic_store(&sh->range[w], pack(mid, end_of(seen)));
+            atomic_fetch_add(&sh->steals, 1);
+            return 1;
+        }
+    }
+}
+
+static void work(struct shares *sh, int num_workers, int w, void (*run)(long item, int worker, void *ctx), void *ctx)
+{
+    long item;
+
+    for (;;)
+    {
+        if (take(sh, w, &item))
+            run(item, w, ctx);
+        else if (!steal(sh, num_workers, w))
+            return;
+    }
+}
+
+long steal_run(const struct sweep *s, long num_items, void (*setup)(int worker, void *ctx),
+               void (*run)(long item, int worker, void *ctx), void *ctx)
+{
+    if (num_items < 0 || num_items > UINT32_MAX)
+        errx(EXIT_FAILURE, "Too many work items: %ld", num_items);
+
+    // A single worker needs no sharing
+    if (s->num_workers == 1)
+    {
+        bind_to_cpu(s->cpus[0]);
+        if (setup)
+            setup(0, ctx);
+        for (long item = 0; item < num_items; item++)
+            run(item, 0, ctx);
+        return 0;
+    }
+
+    struct shares *sh = mmap(NULL, sizeof(*sh), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (sh == MAP_FAILED)
+        err(EXIT_FAILURE, "Unable to map the work shares");
+    for (int w = 0; w < s->num_workers; w++)
+        atomic_init(&sh->range[w], pack(num_items * w / s->num_workers, num_items * (w + 1) / s->num_workers));
+    atomic_init(&sh->steals, 0);
+
+    pid_t pids[SWEEP_MAX_WORKERS];
+    fflush(stdout);
+    for (int w = 0; w < s->num_workers; w++)
+    {
+        pids[w] = fork();
+        if (pids[w] < 0)
+            err(EXIT_FAILURE, "Unable to fork a worker");
+        if (pids[w] > 0)
+            continue;
+
+        bind_to_cpu(s->cpus[w]);
+        if (setup)
+            setup(w, ctx);
+        work(sh, s->num_workers, w, run, ctx);
+        fflush(stdout);
+        _exit(EXIT_SUCCESS);
+    }
+
+    int failed = 0;
+    for (int w = 0; w < s->num_workers; w++)
+    {
+        int status;
+
+        if (waitpid(pids[w], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+        {
+            fprintf(stderr, "Worker on CPU %d failed\n", s->cpus[w]);
+            failed = 1;
+        }
+    }
+    if (failed)
+        exit(EXIT_FAILURE);
+
+    long steals = atomic_load(&sh->steals);
+    munmap(sh, sizeof(*sh));
+    return steals;
+}
@@ -0,0 +1,16 @@
+#ifndef STEAL_H
+#define STEAL_H
+
+#include "workers.h"
+
+// Run items 0..num_items-1 over the workers of s, forked and pinned as in sweep_run. Each worker starts
+// on an equal contiguous share and takes items from its front; one that runs dry steals the back half of
+// the largest share left, so items of uneven cost still keep every CPU busy while neighbouring items
+// mostly stay on one worker. A share is its next and end item in one atomic word, claimed from either end
+// by compare-and-swap, so no worker ever waits for another. Workers share nothing else: results have to
+// go to memory mapped MAP_SHARED before the call, and what workers print is not collected. setup may be
+// NULL. Returns the number of steals.
+long steal_run(const struct sweep *s, long num_items, void (*setup)(int worker, void *ctx),
+               void (*run)(long item, int worker, void *ctx), void *ctx);
+
+#endif
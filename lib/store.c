@@ -0,0 +1,197 @@
+// Point file layout, in the byte order of the host that wrote it (the host is part of every key):
+//   "BPSTORE\1"                 magic and version
+//   u32 length, key             full configuration of the point, to tell hash collisions apart
+//   u32 length, text            what run_point printed
+//   u32 num_columns, then num_columns 8-byte sink values
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "store.h"
+
+static const char store_magic[8] = {'B', 'P', 'S', 'T', 'O', 'R', 'E', 1};
+
+// FNV-1a
+static uint64_t hash(const char *str)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+
+    for (; *str; str++)
+        h = (h ^ (unsigned char)*str) * 0x100000001b3ULL;
+    return h;
+}
+
+// Metadata that differs between two runs of the same configuration
+static const char *volatile_keys[] = {"command", "run", "start"};
+
+static int is_volatile(const char *key)
+{
+    for (size_t k = 0; k < sizeof(volatile_keys) / sizeof(volatile_keys[0]); k++)
+        if (strcmp(key, volatile_keys[k]) == 0)
+            return 1;
+    return 0;
+}
+
+static void config_add(struct store *st, const char *key, const char *value)
+{
+    st->config_len += snprintf(st->config + st->config_len, sizeof(st->config) - st->config_len, "%s=%s\n", key, value);
+    if (st->config_len >= sizeof(st->config))
+    {
+        fprintf(stderr, "Store configuration too long\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+void store_open(struct store *st, const char *dir, int force, const struct sink *s)
+{
+    memset(st, 0, sizeof(*st));
+    st->dir = dir;
+    st->force = force;
+    if (!dir)
+        return;
+
+    if (mkdir(dir, 0755) < 0 && errno != EEXIST)
+    {
+        perror(dir);
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < s->num_meta; i++)
+        if (!is_volatile(s->meta[i].key))
+            config_add(st, s->meta[i].key, s->meta[i].value);
+    // The row layout is part of what a point holds
+    for (int c = 0; c < s->num_columns; c++)
+        config_add(st, "column", s->columns[c].name);
+}
+
+static void point_path(const struct store *st, char *path, size_t size)
+{
+    snprintf(path, size, "%s/%016llx.point", st->dir, (unsigned long long)hash(st->key));
+}
+
+static int read_field(FILE *f, char *buf, size_t size)
+{
+    uint32_t len;
+
+    if (fread(&len, sizeof(len), 1, f) != 1 || len >= size || fread(buf, 1, len, f) != len)
+        return -1;
+    buf[len] = '\0';
+    return len;
+}
+
+// Load the current point into st->text and the sink row; 0 on a miss or a file for another configuration
+static int load(struct store *st, struct sink *s)
+{
+    char path[4096], magic[8], key[STORE_CONFIG_LEN];
+    union sink_value row[SINK_MAX_COLUMNS];
+    uint32_t num_columns;
+    int len, found = 0;
+
+    point_path(st, path, sizeof(path));
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return 0;
+
+    if (fread(magic, sizeof(magic), 1, f) == 1 && memcmp(magic, store_magic, sizeof(magic)) == 0 &&
+        read_field(f, key, sizeof(key)) >= 0 && strcmp(key, st->key) == 0 &&
+        (len = read_field(f, st->text, sizeof(st->text))) >= 0 && fread(&num_columns, sizeof(num_columns), 1, f) == 1 &&
+        num_columns == (uint32_t)s->num_columns && fread(row, sizeof(row[0]), num_columns, f) == num_columns)
+    {
+        st->text_len = len;
+        memcpy(s->row, row, num_columns * sizeof(row[0]));
+        found = 1;
+    }
+    fclose(f);
+    return found;
+}
+
+int store_lookup(struct store *st, struct sink *s, const char *fmt, ...)
+{
+    va_list ap;
+    size_t len;
+
+    st->text_len = 0;
+    if (!st->dir)
+        return 0;
+
+    len = snprintf(st->key, sizeof(st->key), "%spoint=", st->config);
+    va_start(ap, fmt);
+    vsnprintf(st->key + len, sizeof(st->key) - len, fmt, ap);
+    va_end(ap);
+
+    if (st->force || !load(st, s))
+        return 0;
+
+    fwrite(st->text, 1, st->text_len, stdout);
+    sink_emit(s);
+    st->reused++;
+    return 1;
+}
+
+void store_printf(struct store *st, const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    vprintf(fmt, ap);
+    va_end(ap);
+
+    if (!st->dir || st->text_len >= sizeof(st->text))
+        return;
+    va_start(ap, fmt);
+    st->text_len += vsnprintf(st->text + st->text_len, sizeof(st->text) - st->text_len, fmt, ap);
+    va_end(ap);
+    if (st->text_len > sizeof(st->text) - 1)
+        st->text_len = sizeof(st->text) - 1;
+}
+
+void store_commit(struct store *st, struct sink *s)
+{
+    char path[4096], tmp[4096 + 32];
+    uint32_t len;
+
+    sink_emit(s);
+    if (!st->dir)
+        return;
+
+    // Complete under a name of its own, then renamed over whatever was there
+    point_path(st, path, sizeof(path));
+    snprintf(tmp, sizeof(tmp), "%s.%d.tmp", path, (int)getpid());
+    FILE *f = fopen(tmp, "wb");
+    if (!f)
+    {
+        perror(tmp);
+        exit(EXIT_FAILURE);
+    }
+
+    fwrite(store_magic, sizeof(store_magic), 1, f);
+    len = strlen(st->key);
+    fwrite(&len, sizeof(len), 1, f);
+    fwrite(st->key, 1, len, f);
+    len = st->text_len;
+    fwrite(&len, sizeof(len), 1, f);
+    fwrite(st->text, 1, len, f);
+    len = s->num_columns;
+    fwrite(&len, sizeof(len), 1, f);
+    fwrite(s->row, sizeof(s->row[0]), len, f);
+
+    if (fflush(f) != 0 || fsync(fileno(f)) < 0 || fclose(f) != 0 || rename(tmp, path) < 0)
+    {
+        perror(path);
+        unlink(tmp);
+        exit(EXIT_FAILURE);
+    }
+    st->saved++;
+}
+
+void store_report(const struct store *st, FILE *out)
+{
+    if (st->dir)
+        fprintf(out, "Store %s: %ld points reused, %ld measured\n", st->dir, st->reused, st->saved);
+}
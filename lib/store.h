@@ -0,0 +1,44 @@
+#ifndef STORE_H
+#define STORE_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "sink.h"
+
+#define STORE_CONFIG_LEN 4096
+#define STORE_TEXT_LEN 4096
+
+// Completed sweep points kept on disk so an interrupted sweep can be rerun and pick up where it stopped.
+// A point is one file named after the hash of its full configuration: the run metadata of the sink
+// (host, kernel, CPU, governor, timer and the experiment's parameters) and the point's own key. Files are
+// written to a temporary name and renamed into place, so a point is either complete or absent. A point
+// holds the text run_point printed and its sink row; both are replayed when the point is found again.
+struct store
+{
+    const char *dir; // NULL: every lookup misses and nothing is saved
+    int force;       // Measure every point again, replacing what is stored
+    char config[STORE_CONFIG_LEN];
+    size_t config_len;
+    char key[STORE_CONFIG_LEN]; // Configuration of the current point
+    char text[STORE_TEXT_LEN];  // Output of the current point
+    size_t text_len;
+    long reused, saved;
+};
+
+// Use dir, created if missing, or no store with a NULL dir. The configuration is taken from the metadata
+// already given to s, less the entries that change with every invocation. Exits on failure.
+void store_open(struct store *st, const char *dir, int force, const struct sink *s);
+
+// Start a point keyed by fmt. Returns 1 after replaying its stored text and row, 0 if it has to be measured.
+int store_lookup(struct store *st, struct sink *s, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+// printf for run_point output that is to be kept with the point
+void store_printf(struct store *st, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+// Emit the sink row and save the point
+void store_commit(struct store *st, struct sink *s);
+
+void store_report(const struct store *st, FILE *out);
+
+#endif
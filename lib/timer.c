@@ -0,0 +1,227 @@
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "timer.h"
+
+#define CALIBRATION_READS 10000
+#define CALIBRATION_NS 20000000 // Spin this long to measure the tick length
+
+static const char *kind_names[TIMER_NUM_KINDS] = {
+    [TIMER_CNTVCT] = "cntvct",
+    [TIMER_PMU] = "pmu",
+    [TIMER_MONOTONIC_RAW] = "monotonic_raw",
+    [TIMER_RDTSCP] = "rdtscp",
+};
+
+const char *timer_kind_name(enum timer_kind kind)
+{
+    return kind < TIMER_NUM_KINDS ? kind_names[kind] : "unknown";
+}
+
+static uint64_t monotonic_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int perf_open_cycles(uint64_t config1)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.config1 = config1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static int open_pmu(struct timer *t)
+{
+    // On arm64 config1 bit 0 asks for a 64-bit counter and bit 1 for user access (Linux 5.17+)
+#if defined(__aarch64__)
+    t->fd = perf_open_cycles(0x3);
+    if (t->fd < 0)
+#endif
+        t->fd = perf_open_cycles(0);
+    if (t->fd < 0)
+        return -1;
+
+    long page = sysconf(_SC_PAGESIZE);
+    void *pc = mmap(NULL, page, PROT_READ, MAP_SHARED, t->fd, 0);
+    if (pc == MAP_FAILED)
+    {
+        close(t->fd);
+        return -1;
+    }
+    t->pc = pc;
+
+    // The counter index is only published once the event has been scheduled in
+    ioctl(t->fd, PERF_EVENT_IOC_ENABLE, 0);
+    if (!t->pc->cap_user_rdpmc || t->pc->index == 0)
+    {
+        munmap(pc, page);
+        close(t->fd);
+        t->pc = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+int timer_open(struct timer *t, enum timer_kind kind)
+{
+    memset(t, 0, sizeof(*t));
+    t->kind = kind;
+    t->name = timer_kind_name(kind);
+    t->fd = -1;
+
+    switch (kind)
+    {
+    case TIMER_CNTVCT:
+#if defined(__aarch64__)
+        break;
+#else
+        return -1;
+#endif
+    case TIMER_RDTSCP:
+#if defined(__x86_64__) || defined(__i386__)
+        break;
+#else
+        return -1;
+#endif
+    case TIMER_PMU:
+        if (open_pmu(t) < 0)
+            return -1;
+        break;
+    case TIMER_MONOTONIC_RAW:
+        break;
+    default:
+        return -1;
+    }
+
+    timer_calibrate(t);
+    return 0;
+}
+
+void timer_open_named(struct timer *t, const char *name)
+{
+    if (name && strcmp(name, "auto") != 0)
+    {
+        for (int k = 0; k < TIMER_NUM_KINDS; k++)
+        {
+            if (strcmp(name, kind_names[k]) != 0)
+                continue;
+            if (timer_open(t, k) < 0)
+            {
+                fprintf(stderr, "Timer %s is not available on this system\n", name);
+                exit(EXIT_FAILURE);
+            }
+            return;
+        }
+        fprintf(stderr, "Unknown timer %s\n", name);
+        exit(EXIT_FAILURE);
+    }
+
+    // Pick the finest resolution in ns, breaking ties on the cheaper read
+    struct timer best = {.fd = -1}, cand;
+    int found = 0;
+    for (int k = 0; k < TIMER_NUM_KINDS; k++)
+    {
+        if (timer_open(&cand, k) < 0)
+            continue;
+
+        double res = cand.resolution * cand.ns_per_tick, best_res = best.resolution * best.ns_per_tick;
+        if (!found || res < best_res ||
+            (res == best_res && cand.overhead * cand.ns_per_tick < best.overhead * best.ns_per_tick))
+        {
+            if (found)
+                timer_close(&best);
+            best = cand;
+            found = 1;
+        }
+        else
+            timer_close(&cand);
+    }
+
+    if (!found)
+    {
+        fprintf(stderr, "No timer available\n");
+        exit(EXIT_FAILURE);
+    }
+    *t = best;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+void timer_calibrate(struct timer *t)
+{
+    // Tick length: the generic timer publishes its frequency, everything else is measured
+    if (t->kind == TIMER_MONOTONIC_RAW)
+        t->ns_per_tick = 1.0;
+#if defined(__aarch64__)
+    else if (t->kind == TIMER_CNTVCT)
+        t->ns_per_tick = 1e9 / read_cntfrq();
+#endif
+    else
+    {
+        uint64_t ns0 = monotonic_ns(), r0 = timer_read(t), ns1;
+        while ((ns1 = monotonic_ns()) - ns0 < CALIBRATION_NS)
+            ;
+        uint64_t r1 = timer_read(t);
+        t->ns_per_tick = r1 > r0 ? (double)(ns1 - ns0) / (r1 - r0) : 1.0;
+    }
+
+    // Resolution and overhead from back-to-back reads
+    uint64_t *deltas = malloc(CALIBRATION_READS * sizeof(*deltas));
+    for (int i = 0; i < CALIBRATION_READS; i++)
+    {
+        uint64_t a = timer_read(t);
+        uint64_t b = timer_read(t);
+        deltas[i] = b - a;
+    }
+    qsort(deltas, CALIBRATION_READS, sizeof(*deltas), compare_u64);
+
+    t->overhead = deltas[CALIBRATION_READS / 2];
+    t->resolution = 0;
+    for (int i = 0; i < CALIBRATION_READS; i++)
+    {
+        if (deltas[i] > 0)
+        {
+            t->resolution = deltas[i];
+            break;
+        }
+    }
+    if (t->resolution == 0) // The counter never ticked between two reads; one tick is the floor
+        t->resolution = 1;
+    free(deltas);
+}
+
+void timer_report(const struct timer *t, FILE *out)
+{
+    fprintf(out, "Timer: %s, tick: %f ns, resolution: %.0f ticks (%f ns), overhead: %.0f ticks (%f ns)\n", t->name,
+            t->ns_per_tick, t->resolution, t->resolution * t->ns_per_tick, t->overhead, t->overhead * t->ns_per_tick);
+}
+
+void timer_close(struct timer *t)
+{
+    if (t->pc)
+        munmap((void *)t->pc, sysconf(_SC_PAGESIZE));
+    if (t->fd >= 0)
+        close(t->fd);
+    t->pc = NULL;
+    t->fd = -1;
+}
@@ -0,0 +1,150 @@
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <linux/perf_event.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "bpure.h"
+
+// Counter a timer reads
+enum timer_kind
+{
+    TIMER_CNTVCT,        // cntvct_el0, the generic timer (AArch64)
+    TIMER_PMU,           // CPU cycle counter read from user space through a perf_event mmap page
+    TIMER_MONOTONIC_RAW, // clock_gettime(CLOCK_MONOTONIC_RAW)
+    TIMER_RDTSCP,        // rdtscp (x86)
+    TIMER_NUM_KINDS,
+};
+
+struct timer
+{
+    enum timer_kind kind;
+    const char *name;
+    int fd;                                   // perf event backing TIMER_PMU
+    volatile struct perf_event_mmap_page *pc; // Self-monitoring page of fd
+    double ns_per_tick;                       // Tick length against CLOCK_MONOTONIC_RAW
+    double resolution;                        // Smallest non-zero difference between two reads, in ticks
+    double overhead;                          // Median difference between two back-to-back reads, in ticks
+};
+
+// Open a backend; returns -1 if the hardware or kernel does not provide it
+int timer_open(struct timer *t, enum timer_kind kind);
+
+// Open a backend by name, or with "auto" (or NULL) the one with the finest resolution. Exits on failure.
+void timer_open_named(struct timer *t, const char *name);
+
+// Measure the tick length, resolution and read overhead
+void timer_calibrate(struct timer *t);
+
+void timer_report(const struct timer *t, FILE *out);
+void timer_close(struct timer *t);
+
+const char *timer_kind_name(enum timer_kind kind);
+
+// Ordering barrier around every counter read
+__attribute__((always_inline)) static inline void timer_fence(void)
+{
+#if defined(__aarch64__)
+    asm volatile("dsb ish" ::: "memory");
+#elif defined(__x86_64__) || defined(__i386__)
+    asm volatile("lfence" ::: "memory");
+#else
+    asm volatile("" ::: "memory");
+#endif
+}
+
+// Raw read of hardware performance counter idx, as published in perf_event_mmap_page.index - 1
+__attribute__((always_inline)) static inline uint64_t timer_read_pmc(uint32_t idx)
+{
+    uint64_t val = 0;
+#if defined(__aarch64__)
+    // The cycle counter is index 31; Cortex-A72 has six event counters
+    switch (idx)
+    {
+    case 31: asm volatile("mrs %0, pmccntr_el0" : "=r"(val)); break;
+    case 0: asm volatile("mrs %0, pmevcntr0_el0" : "=r"(val)); break;
+    case 1: asm volatile("mrs %0, pmevcntr1_el0" : "=r"(val)); break;
+    case 2: asm volatile("mrs %0, pmevcntr2_el0" : "=r"(val)); break;
+    case 3: asm volatile("mrs %0, pmevcntr3_el0" : "=r"(val)); break;
+    case 4: asm volatile("mrs %0, pmevcntr4_el0" : "=r"(val)); break;
+    case 5: asm volatile("mrs %0, pmevcntr5_el0" : "=r"(val)); break;
+    }
+#elif defined(__x86_64__) || defined(__i386__)
+    uint32_t lo, hi;
+    asm volatile("rdpmc" : "=a"(lo), "=d"(hi) : "c"(idx));
+    val = (uint64_t)hi << 32 | lo;
+#else
+    (void)idx;
+#endif
+    return val;
+}
+
+// Self-monitoring read of a perf event, see the comment on perf_event_mmap_page in linux/perf_event.h
+__attribute__((always_inline)) static inline uint64_t timer_read_perf(volatile struct perf_event_mmap_page *pc)
+{
+    uint32_t seq, idx;
+    uint64_t count;
+
+    do
+    {
+        seq = pc->lock;
+        asm volatile("" ::: "memory");
+        idx = pc->index;
+        count = pc->offset;
+        if (pc->cap_user_rdpmc && idx)
+        {
+            uint16_t width = pc->pmc_width;
+            int64_t pmc = timer_read_pmc(idx - 1);
+            pmc <<= 64 - width; // Sign extend the counter to 64 bits
+            pmc >>= 64 - width;
+            count += pmc;
+        }
+        asm volatile("" ::: "memory");
+    } while (pc->lock != seq);
+
+    return count;
+}
+
+// Read the current time in the backend's ticks
+__attribute__((always_inline)) static inline uint64_t timer_read(const struct timer *t)
+{
+    uint64_t val = 0;
+
+    timer_fence();
+    switch (t->kind)
+    {
+#if defined(__aarch64__)
+    case TIMER_CNTVCT:
+        asm volatile("mrs %0, cntvct_el0" : "=r"(val));
+        break;
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+    case TIMER_RDTSCP:
+    {
+        uint32_t lo, hi, aux;
+        asm volatile("rdtscp" : "=a"(lo), "=d"(hi), "=c"(aux));
+        val = (uint64_t)hi << 32 | lo;
+        break;
+    }
+#endif
+    case TIMER_PMU:
+        val = timer_read_perf(t->pc);
+        break;
+    case TIMER_MONOTONIC_RAW:
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+        val = (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+        break;
+    }
+    default:
+        break;
+    }
+    timer_fence();
+
+    return val;
+}
+
+#endif
@@ -0,0 +1,183 @@
+#include <err.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "trace.h"
+
+static void write_all(int fd, const char *path, const void *buf, size_t len, uint64_t offset)
+{
+    const uint8_t *p = buf;
+
+    while (len > 0)
+    {
+        ssize_t n = pwrite(fd, p, len, offset);
+        if (n < 0)
+            err(EXIT_FAILURE, "%s", path);
+        p += n;
+        len -= n;
+        offset += n;
+    }
+}
+
+static uint8_t *put_varint(uint8_t *p, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        *p++ = (value & 0x7f) | 0x80;
+        value >>= 7;
+    }
+    *p++ = value;
+    return p;
+}
+
+static uint64_t zigzag(uint64_t delta)
+{
+    return (delta << 1) ^ -(delta >> 63);
+}
+
+void trace_create(struct trace_writer *w, const char *path)
+{
+    memset(w, 0, sizeof(*w));
+    w->path = path;
+    w->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (w->fd < 0)
+        err(EXIT_FAILURE, "%s", path);
+    w->buf = malloc((size_t)TRACE_BLOCK_RECORDS * TRACE_MAX_RECORD);
+    if (!w->buf)
+        err(EXIT_FAILURE, "Unable to allocate the trace block");
+    w->offset = sizeof(struct trace_header); // Written last, once the index is known
+}
+
+static void flush_block(struct trace_writer *w)
+{
+    if (w->block_records == 0)
+        return;
+
+    if (w->blocks == w->capacity)
+    {
+        w->capacity = w->capacity ? 2 * w->capacity : 256;
+        w->index = realloc(w->index, w->capacity * sizeof(struct trace_block));
+        if (!w->index)
+            err(EXIT_FAILURE, "Unable to allocate the trace index");
+    }
+    struct trace_block *b = &w->index[w->blocks++];
+    b->offset = w->offset;
+    b->first = w->records - w->block_records;
+    b->records = w->block_records;
+    b->size = w->len;
+
+    write_all(w->fd, w->path, w->buf, w->len, w->offset);
+    w->offset += w->len;
+    w->len = 0;
+    w->block_records = 0;
+    w->next = 0;
+}
+
+void trace_write(struct trace_writer *w, uint64_t pc, uint64_t target, enum trace_kind kind, int taken)
+{
+    uint8_t *p = w->buf + w->len;
+
+    *p++ = kind | (taken ? 8 : 0);
+    p = put_varint(p, zigzag(pc - w->next));
+    p = put_varint(p, zigzag(target - pc));
+    w->len = p - w->buf;
+    w->next = taken ? target : pc + 4;
+    w->records++;
+    if (++w->block_records == TRACE_BLOCK_RECORDS)
+        flush_block(w);
+}
+
+void trace_finish(struct trace_writer *w)
+{
+    static const uint8_t padding[TRACE_INDEX_ALIGN];
+    struct trace_header h;
+
+    flush_block(w);
+    size_t pad = -w->offset % TRACE_INDEX_ALIGN;
+    write_all(w->fd, w->path, padding, pad, w->offset);
+    w->offset += pad;
+    write_all(w->fd, w->path, w->index, w->blocks * sizeof(struct trace_block), w->offset);
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, TRACE_MAGIC, sizeof(h.magic));
+    h.records = w->records;
+    h.index_offset = w->offset;
+    h.blocks = w->blocks;
+    h.block_records = TRACE_BLOCK_RECORDS;
+    write_all(w->fd, w->path, &h, sizeof(h), 0);
+
+    if (close(w->fd) < 0)
+        err(EXIT_FAILURE, "%s", w->path);
+    free(w->buf);
+    free(w->index);
+    w->buf = NULL;
+    w->index = NULL;
+}
+
+void trace_open(struct trace *t, const char *path)
+{
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &st) < 0)
+        err(EXIT_FAILURE, "%s", path);
+    if ((size_t)st.st_size < sizeof(struct trace_header))
+        errx(EXIT_FAILURE, "%s: not a branch trace", path);
+
+    t->size = st.st_size;
+    t->data = mmap(NULL, t->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (t->data == MAP_FAILED)
+        err(EXIT_FAILURE, "%s", path);
+    madvise((void *)t->data, t->size, MADV_SEQUENTIAL);
+
+    t->header = (const struct trace_header *)t->data;
+    if (memcmp(t->header->magic, TRACE_MAGIC, sizeof(t->header->magic)) != 0)
+        errx(EXIT_FAILURE, "%s: not a branch trace", path);
+    if (t->header->index_offset % TRACE_INDEX_ALIGN != 0)
+        errx(EXIT_FAILURE, "%s: misaligned trace index", path);
+    if (t->header->index_offset > t->size ||
+        (t->size - t->header->index_offset) / sizeof(struct trace_block) < t->header->blocks)
+        errx(EXIT_FAILURE, "%s: truncated trace", path);
+    t->index = (const struct trace_block *)(t->data + t->header->index_offset);
+    for (uint32_t b = 0; b < t->header->blocks; b++)
+        if (t->index[b].offset > t->header->index_offset ||
+            t->index[b].size > t->header->index_offset - t->index[b].offset)
+            errx(EXIT_FAILURE, "%s: block %u outside the trace", path, b);
+}
+
+void trace_close(struct trace *t)
+{
+    munmap((void *)t->data, t->size);
+    t->data = NULL;
+}
+
+void trace_seek(const struct trace *t, struct trace_cursor *c, uint32_t first, uint32_t end)
+{
+    c->t = t;
+    c->block = first;
+    c->end = end < t->header->blocks ? end : t->header->blocks;
+    c->left = 0;
+    c->p = NULL;
+    c->next = 0;
+}
+
+int trace_next_block(struct trace_cursor *c)
+{
+    while (c->block < c->end)
+    {
+        const struct trace_block *b = &c->t->index[c->block++];
+
+        if (b->records == 0)
+            continue;
+        c->p = c->t->data + b->offset;
+        c->left = b->records;
+        c->next = 0;
+        return 1;
+    }
+    return 0;
+}
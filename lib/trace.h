@@ -0,0 +1,133 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TRACE_MAGIC "BPTRACE\1"
+#define TRACE_BLOCK_RECORDS 65536 // Records per block
+#define TRACE_MAX_RECORD 21       // Bytes one record can take: flags and two 10-byte varints
+#define TRACE_INDEX_ALIGN 8       // The index is read in place from the mapping
+
+enum trace_kind
+{
+    TRACE_COND, // b.cond and friends
+    TRACE_JUMP, // b
+    TRACE_CALL, // bl
+    TRACE_RET,
+    TRACE_INDIRECT, // br, blr
+};
+
+struct trace_record
+{
+    uint64_t pc, target; // target is where a not-taken conditional branch would have gone
+    enum trace_kind kind;
+    int taken;
+};
+
+// A trace file is this header, the blocks, zero padding up to TRACE_INDEX_ALIGN, and the index of the
+// blocks, all in host byte order. A record is
+// a flags byte (kind in bits 0-2, taken in bit 3), then the zigzag varint distance of its pc from where
+// execution went after the previous record (its target if taken, the next instruction if not), then the
+// distance of its target from its pc. Both are a few bytes for straight-line code. Every block starts
+// from address 0, so blocks decode on their own and can be handed to different readers.
+struct trace_header
+{
+    char magic[8];
+    uint64_t records;
+    uint64_t index_offset;
+    uint32_t blocks;
+    uint32_t block_records;
+};
+
+struct trace_block
+{
+    uint64_t offset; // Of its first byte in the file
+    uint64_t first;  // Number of its first record in the trace
+    uint32_t records;
+    uint32_t size;
+};
+
+struct trace_writer
+{
+    int fd;
+    const char *path;
+    uint8_t *buf; // The block being filled
+    size_t len;
+    uint32_t block_records;
+    uint64_t next; // Where execution went after the last record
+    uint64_t offset, records;
+    struct trace_block *index;
+    uint32_t blocks, capacity;
+};
+
+// Whole file mapped read-only; records are decoded straight from the mapping
+struct trace
+{
+    const uint8_t *data;
+    size_t size;
+    const struct trace_header *header;
+    const struct trace_block *index;
+};
+
+// Position in a run of blocks
+struct trace_cursor
+{
+    const struct trace *t;
+    const uint8_t *p;
+    uint64_t next;
+    uint32_t left; // Records left in the current block
+    uint32_t block, end;
+};
+
+// Exits on failure
+void trace_create(struct trace_writer *w, const char *path);
+void trace_write(struct trace_writer *w, uint64_t pc, uint64_t target, enum trace_kind kind, int taken);
+
+// Write the last block, the index and the header, and close the file
+void trace_finish(struct trace_writer *w);
+
+// Map and check a trace file; exits on failure
+void trace_open(struct trace *t, const char *path);
+void trace_close(struct trace *t);
+
+// Read blocks [first, end) of t, or all of them with end = t->header->blocks
+void trace_seek(const struct trace *t, struct trace_cursor *c, uint32_t first, uint32_t end);
+
+// Move c to the next non-empty block; returns 0 past the last
+int trace_next_block(struct trace_cursor *c);
+
+static inline uint64_t trace_varint(const uint8_t **p)
+{
+    uint64_t value = 0;
+    int shift = 0;
+    uint8_t byte;
+
+    do
+    {
+        byte = *(*p)++;
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
+// Decode the next record into r; returns 0 at the end
+static inline int trace_next(struct trace_cursor *c, struct trace_record *r)
+{
+    if (c->left == 0 && !trace_next_block(c))
+        return 0;
+
+    uint8_t flags = *c->p++;
+    uint64_t delta = trace_varint(&c->p);
+    r->pc = c->next + ((delta >> 1) ^ -(delta & 1));
+    delta = trace_varint(&c->p);
+    r->target = r->pc + ((delta >> 1) ^ -(delta & 1));
+    r->kind = flags & 7;
+    r->taken = (flags >> 3) & 1;
+    c->next = r->taken ? r->target : r->pc + 4;
+    c->left--;
+    return 1;
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "trials.h"
+
+double welford_var(const struct welford *w)
+{
+    return w->n > 1 ? w->m2 / (w->n - 1) : 0;
+}
+
+double welford_ci(const struct welford *w)
+{
+    return w->n > 1 ? TRIALS_Z * sqrt(welford_var(w) / w->n) : INFINITY;
+}
+
+int welford_separated(const struct welford *a, const struct welford *b)
+{
+    return fabs(a->mean - b->mean) > welford_ci(a) + welford_ci(b);
+}
+
+void trials_init(struct trials *tc, long max, double rel_err)
+{
+    if (max < 1)
+    {
+        fprintf(stderr, "Trial budget must be positive: %ld\n", max);
+        exit(EXIT_FAILURE);
+    }
+
+    tc->max = max;
+    tc->min = max < TRIALS_MIN ? max : TRIALS_MIN;
+    tc->rel_err = rel_err;
+    tc->limit = rel_err > 0 ? max * TRIALS_EXTEND : max;
+}
+
+static int converged(const struct trials *tc, const struct welford *w)
+{
+    return tc->rel_err > 0 && welford_ci(w) <= tc->rel_err * fabs(w->mean);
+}
+
+int trials_done(const struct trials *tc, const struct welford *w)
+{
+    if (w->n < tc->min)
+        return 0;
+    return w->n >= tc->max || converged(tc, w);
+}
+
+int trials_done_pair(const struct trials *tc, const struct welford *a, const struct welford *b)
+{
+    long n = a->n < b->n ? a->n : b->n;
+
+    if (n < tc->min)
+        return 0;
+    if (n >= tc->limit)
+        return 1;
+    if (!welford_separated(a, b))
+        return 0;
+    return n >= tc->max || (converged(tc, a) && converged(tc, b));
+}
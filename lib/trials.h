@@ -0,0 +1,67 @@
+#ifndef TRIALS_H
+#define TRIALS_H
+
+#define TRIALS_MIN 500      // Samples taken before the interval is trusted
+#define TRIALS_MAX 10000    // Budget for a point whose interval is tight or clearly separated
+#define TRIALS_EXTEND 4     // Overlapping comparisons may run to TRIALS_EXTEND * max samples
+#define TRIALS_REL_ERR 0.01 // Default target half-width of the interval relative to the mean
+#define TRIALS_Z 1.96       // Two-sided 95% normal quantile
+
+// Running mean and variance of a sample stream (Welford's algorithm)
+struct welford
+{
+    long n;
+    double mean;
+    double m2; // Sum of squared deviations from the running mean
+};
+
+// When to stop sampling one sweep point
+struct trials
+{
+    long min;
+    long max;
+    long limit; // Hard cap once comparisons overlap
+    double rel_err;
+};
+
+static inline void welford_init(struct welford *w)
+{
+    w->n = 0;
+    w->mean = 0;
+    w->m2 = 0;
+}
+
+static inline void welford_add(struct welford *w, double x)
+{
+    double d = x - w->mean;
+
+    w->n++;
+    w->mean += d / w->n;
+    w->m2 += d * (x - w->mean);
+}
+
+double welford_var(const struct welford *w);
+
+// Half-width of the confidence interval of the mean
+double welford_ci(const struct welford *w);
+
+// Nonzero when the confidence intervals of a and b do not intersect
+int welford_separated(const struct welford *a, const struct welford *b);
+
+// max is the regular budget; rel_err <= 0 disables early stopping so exactly max samples are taken
+void trials_init(struct trials *tc, long max, double rel_err);
+
+// Attempts, dropped ones included, after which a point settles for the samples it has
+static inline long trials_max_attempts(const struct trials *tc)
+{
+    return TRIALS_EXTEND * tc->limit;
+}
+
+// Nonzero when w has reached the target relative error, or the budget is spent
+int trials_done(const struct trials *tc, const struct welford *w);
+
+// Nonzero when both a and b have reached the target relative error and their intervals are apart.
+// Overlapping pairs run past max, up to limit, before giving up.
+int trials_done_pair(const struct trials *tc, const struct welford *a, const struct welford *b);
+
+#endif
@@ -0,0 +1,317 @@
+#define _GNU_SOURCE
+
+#include <err.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "bpure.h"
+#include "workers.h"
+
+#define SWEEP_POLL_US 100 // How often idle workers and the waiting parent look at the board
+
+// Where one chunk of a worker's output sits in its spool file
+struct chunk
+{
+    int worker;
+    long offset;
+    long length; // -1 until written
+};
+
+// Shared between the parent and all workers
+struct sweep_board
+{
+    atomic_int round; // Bumped by the parent to hand out the next round
+    atomic_int next;
+    atomic_int done;  // Workers through the current round
+    int num_points;   // Of the current round, -1 once the pool is finishing
+    struct chunk setup[SWEEP_MAX_WORKERS];
+    struct chunk teardown[SWEEP_MAX_WORKERS];
+    struct chunk points[];
+};
+
+void sweep_parse(struct sweep *s, const char *spec, int reserve, int default_cpu)
+{
+    cpu_set_t set;
+
+    s->num_workers = 0;
+    if (!spec)
+        s->cpus[s->num_workers++] = default_cpu;
+    else if (strcmp(spec, "all") == 0)
+    {
+        if (sched_getaffinity(0, sizeof(set), &set) < 0)
+            err(EXIT_FAILURE, "Unable to get CPU affinity");
+        for (int cpu = 0; cpu < CPU_SETSIZE && s->num_workers < SWEEP_MAX_WORKERS; cpu++)
+            if (CPU_ISSET(cpu, &set))
+                s->cpus[s->num_workers++] = cpu;
+    }
+    else
+        s->num_workers = parse_range(spec, s->cpus, SWEEP_MAX_WORKERS);
+
+    if (reserve && s->num_workers > 1)
+    {
+        int lowest = 0;
+
+        for (int i = 1; i < s->num_workers; i++)
+            if (s->cpus[i] < s->cpus[lowest])
+                lowest = i;
+        s->cpus[lowest] = s->cpus[--s->num_workers];
+    }
+    else if (reserve)
+        fprintf(stderr, "Only one CPU to run on, not reserving one for the OS\n");
+
+    if (s->num_workers < 1)
+    {
+        fprintf(stderr, "No CPUs to run on: %s\n", spec);
+        exit(EXIT_FAILURE);
+    }
+}
+
+enum phase
+{
+    PHASE_SETUP,
+    PHASE_RUN,
+    PHASE_TEARDOWN,
+};
+
+// Run one callback and note where its output landed in the spool behind stdout
+static void spool(struct chunk *c, int worker, const struct sweep_pool *p, enum phase phase, int arg)
+{
+    fflush(stdout);
+    c->worker = worker;
+    c->offset = lseek(STDOUT_FILENO, 0, SEEK_CUR);
+    switch (phase)
+    {
+    case PHASE_SETUP:
+        p->setup(arg, p->ctx);
+        break;
+    case PHASE_RUN:
+        p->run(arg, p->ctx);
+        break;
+    case PHASE_TEARDOWN:
+        p->teardown(p->ctx);
+        break;
+    }
+    fflush(stdout);
+    c->length = lseek(STDOUT_FILENO, 0, SEEK_CUR) - c->offset;
+}
+
+static void replay(const struct chunk *c, FILE *const *spools)
+{
+    char buf[4096];
+    long left = c->length;
+
+    if (left <= 0)
+        return;
+    fseek(spools[c->worker], c->offset, SEEK_SET);
+    while (left > 0)
+    {
+        size_t n = fread(buf, 1, left < (long)sizeof(buf) ? left : (long)sizeof(buf), spools[c->worker]);
+        if (n == 0)
+            break;
+        fwrite(buf, 1, n, stdout);
+        left -= n;
+    }
+}
+
+// Worker: stdout goes to its spool, each round's points are claimed one at a time
+static void work(struct sweep_pool *p, int w)
+{
+    struct sweep_board *board = p->board;
+    int point;
+
+    if (dup2(fileno(p->spools[w]), STDOUT_FILENO) < 0)
+        err(EXIT_FAILURE, "Unable to redirect worker output");
+    bind_to_cpu(p->s.cpus[w]);
+    if (p->setup)
+        spool(&board->setup[w], w, p, PHASE_SETUP, p->s.cpus[w]);
+
+    for (int round = 1;; round++)
+    {
+        while (atomic_load(&board->round) < round)
+            usleep(SWEEP_POLL_US);
+        if (board->num_points < 0)
+            break;
+        while ((point = atomic_fetch_add(&board->next, 1)) < board->num_points)
+            spool(&board->points[point], w, p, PHASE_RUN, point);
+        atomic_fetch_add(&board->done, 1);
+    }
+
+    if (p->teardown)
+        spool(&board->teardown[w], w, p, PHASE_TEARDOWN, 0);
+    fflush(stdout);
+    _exit(EXIT_SUCCESS);
+}
+
+static void replay_workers(const struct sweep_pool *p, const struct chunk *chunks)
+{
+    for (int w = 0; w < p->s.num_workers; w++)
+    {
+        printf("Worker %d on CPU %d:\n", w, p->s.cpus[w]);
+        replay(&chunks[w], p->spools);
+    }
+}
+
+void sweep_pool_start(struct sweep_pool *p, const struct sweep *s, int max_points, void (*setup)(int cpu, void *ctx),
+                      void (*run)(int point, void *ctx), void (*teardown)(void *ctx), void *ctx)
+{
+    memset(p, 0, sizeof(*p));
+    p->s = *s;
+    p->max_points = max_points;
+    p->setup = setup;
+    p->run = run;
+    p->teardown = teardown;
+    p->ctx = ctx;
+
+    // A single worker needs no spooling; keep the output live
+    if (s->num_workers == 1)
+    {
+        bind_to_cpu(s->cpus[0]);
+        if (setup)
+            setup(s->cpus[0], ctx);
+        return;
+    }
+
+    p->board_size = sizeof(struct sweep_board) + max_points * sizeof(struct chunk);
+    p->board = mmap(NULL, p->board_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (p->board == MAP_FAILED)
+        err(EXIT_FAILURE, "Unable to map the sweep board");
+    atomic_init(&p->board->round, 0);
+    atomic_init(&p->board->next, 0);
+    atomic_init(&p->board->done, 0);
+
+    fflush(stdout);
+    for (int w = 0; w < s->num_workers; w++)
+    {
+        p->spools[w] = tmpfile();
+        if (!p->spools[w])
+            err(EXIT_FAILURE, "Unable to create a spool file");
+
+        p->pids[w] = fork();
+        if (p->pids[w] < 0)
+            err(EXIT_FAILURE, "Unable to fork a worker");
+        if (p->pids[w] == 0)
+            work(p, w);
+    }
+}
+
+// Wait for every worker to get through the round; a worker that exits before the pool finishes has failed
+static void wait_round(struct sweep_pool *p)
+{
+    while (atomic_load(&p->board->done) < p->s.num_workers)
+    {
+        for (int w = 0; w < p->s.num_workers; w++)
+        {
+            int status;
+
+            if (waitpid(p->pids[w], &status, WNOHANG) != 0)
+            {
+                fprintf(stderr, "Worker on CPU %d failed\n", p->s.cpus[w]);
+                for (int v = 0; v < p->s.num_workers; v++)
+                    if (v != w)
+                        kill(p->pids[v], SIGKILL);
+                exit(EXIT_FAILURE);
+            }
+        }
+        usleep(SWEEP_POLL_US);
+    }
+}
+
+void sweep_pool_run(struct sweep_pool *p, int num_points)
+{
+    struct sweep_board *board = p->board;
+    int failed = 0;
+
+    if (num_points > p->max_points)
+        errx(EXIT_FAILURE, "Sweep round of %d points, the pool was started for %d", num_points, p->max_points);
+
+    if (p->s.num_workers == 1)
+    {
+        for (int point = 0; point < num_points; point++)
+            p->run(point, p->ctx);
+        p->rounds++;
+        return;
+    }
+
+    board->num_points = num_points;
+    for (int i = 0; i < num_points; i++)
+        board->points[i].length = -1;
+    atomic_store(&board->next, 0);
+    atomic_store(&board->done, 0);
+    atomic_fetch_add(&board->round, 1);
+    wait_round(p);
+
+    // Replay in a fixed order so the output matches a serial run
+    if (p->setup && p->rounds == 0)
+        replay_workers(p, board->setup);
+    for (int i = 0; i < num_points; i++)
+    {
+        if (board->points[i].length < 0)
+        {
+            fprintf(stderr, "Point %d was not completed\n", i);
+            failed = 1;
+            continue;
+        }
+        replay(&board->points[i], p->spools);
+    }
+    fflush(stdout);
+    p->rounds++;
+
+    if (failed)
+        exit(EXIT_FAILURE);
+}
+
+void sweep_pool_finish(struct sweep_pool *p)
+{
+    int failed = 0;
+
+    if (p->s.num_workers == 1)
+    {
+        if (p->teardown)
+            p->teardown(p->ctx);
+        return;
+    }
+
+    p->board->num_points = -1;
+    atomic_fetch_add(&p->board->round, 1);
+    for (int w = 0; w < p->s.num_workers; w++)
+    {
+        int status;
+
+        if (waitpid(p->pids[w], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+        {
+            fprintf(stderr, "Worker on CPU %d failed\n", p->s.cpus[w]);
+            failed = 1;
+        }
+    }
+
+    if (p->setup && p->rounds == 0)
+        replay_workers(p, p->board->setup);
+    if (p->teardown)
+        replay_workers(p, p->board->teardown);
+    fflush(stdout);
+
+    for (int w = 0; w < p->s.num_workers; w++)
+        fclose(p->spools[w]);
+    munmap(p->board, p->board_size);
+    p->board = NULL;
+
+    if (failed)
+        exit(EXIT_FAILURE);
+}
+
+void sweep_run(const struct sweep *s, int num_points, void (*setup)(int cpu, void *ctx),
+               void (*run)(int point, void *ctx), void (*teardown)(void *ctx), void *ctx)
+{
+    struct sweep_pool pool;
+
+    sweep_pool_start(&pool, s, num_points, setup, run, teardown, ctx);
+    sweep_pool_run(&pool, num_points);
+    sweep_pool_finish(&pool);
+}
@@ -0,0 +1,64 @@
+#ifndef WORKERS_H
+#define WORKERS_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#define SWEEP_MAX_WORKERS 256
+
+// CPUs the points of a sweep are spread over, one pinned worker process each
+struct sweep
+{
+    int cpus[SWEEP_MAX_WORKERS];
+    int num_workers;
+};
+
+// spec is NULL for the single CPU default_cpu, "all" for every CPU the process may run on, or a range
+// as accepted by parse_range. With reserve set the lowest of those CPUs is left to the OS.
+void sweep_parse(struct sweep *s, const char *spec, int reserve, int default_cpu);
+
+// Run points 0..num_points-1 over the workers of s. Each worker is bound to its CPU and calls setup
+// once, then takes the next unclaimed point and calls run on it until none are left, then calls
+// teardown. Predictor state is per core, so workers share nothing but the point counter.
+//
+// Everything a worker prints to stdout is collected per point and replayed in order once all workers
+// finish: setup output of every worker, then the points, then teardown output. With one worker the
+// callbacks run in the calling process and print directly. setup and teardown may be NULL.
+void sweep_run(const struct sweep *s, int num_points, void (*setup)(int cpu, void *ctx),
+               void (*run)(int point, void *ctx), void (*teardown)(void *ctx), void *ctx);
+
+struct sweep_board;
+
+// Workers kept up across several rounds of points, for sweeps that pick their next points from the
+// results of the last ones: setup runs once per worker for all rounds, so what it calibrates is shared
+// by every point, and teardown once at the end.
+struct sweep_pool
+{
+    struct sweep s;
+    int max_points;
+    void (*setup)(int cpu, void *ctx);
+    void (*run)(int point, void *ctx);
+    void (*teardown)(void *ctx);
+    void *ctx;
+    struct sweep_board *board; // Shared with the workers
+    size_t board_size;
+    FILE *spools[SWEEP_MAX_WORKERS];
+    pid_t pids[SWEEP_MAX_WORKERS];
+    int rounds;
+};
+
+// Fork and set up the workers of s, or set up in the calling process with one worker. Anything the
+// workers should see of the caller's memory has to exist before this call, in memory mapped MAP_SHARED
+// if the parent changes it between rounds.
+void sweep_pool_start(struct sweep_pool *p, const struct sweep *s, int max_points, void (*setup)(int cpu, void *ctx),
+                      void (*run)(int point, void *ctx), void (*teardown)(void *ctx), void *ctx);
+
+// Run points 0..num_points-1, at most max_points, and wait for all of them. Output is replayed as by
+// sweep_run, setup output before the points of the first round.
+void sweep_pool_run(struct sweep_pool *p, int num_points);
+
+// Tear the workers down and replay their teardown output
+void sweep_pool_finish(struct sweep_pool *p);
+
+#endif
@@ -0,0 +1,336 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "analyze.h"
+#include "spec.h"
+
+#define MAX_ARGS 64
+#define MAX_OPTIONS 24
+
+// How the value of a key is handed to the experiment
+enum option_kind
+{
+    OPT_VALUE,  // Passed through as the flag's argument
+    OPT_SWITCH, // Flag without an argument, given when the value is true
+    OPT_PATH,   // File the experiment creates; made absolute since it runs from its own directory
+    OPT_PATHS,  // Comma separated files, each made absolute as OPT_PATH
+};
+
+// Spec key translated to a command line flag of the experiment binary
+struct option_map
+{
+    const char *key;
+    char flag;
+    enum option_kind kind;
+};
+
+// Experiment binaries are run from their own directory so that they find their branch.o
+struct experiment
+{
+    const char *name;
+    const char *dir;
+    const char *binary;
+    struct option_map options[MAX_OPTIONS];
+};
+
+// Keys shared by several experiments
+#define TIMING_OPTIONS {"cpu", 'c', OPT_VALUE}, {"timer", 't', OPT_VALUE}
+#define TRIAL_OPTIONS {"trials", 'n', OPT_VALUE}, {"rel_err", 'e', OPT_VALUE}, {"perturb", 'P', OPT_VALUE}
+#define SWEEP_OPTIONS \
+    {"cpus", 'j', OPT_VALUE}, {"reserve", 'k', OPT_SWITCH}, {"store", 'R', OPT_PATH}, {"force", 'F', OPT_SWITCH}, \
+    {"refine", 'A', OPT_VALUE}
+#define RESULT_OPTIONS {"results", 'o', OPT_PATH}, {"format", 'f', OPT_VALUE}
+
+static const struct experiment experiments[] = {
+    {"time_diff", ".", "./time_diff",
+     {TIMING_OPTIONS, TRIAL_OPTIONS, RESULT_OPTIONS, {"address", 'a', OPT_VALUE}, {"mode", 'm', OPT_VALUE},
+      {"batch_target", 'B', OPT_VALUE}, {"seed", 'S', OPT_VALUE}}},
+    {"ghr_len", "CBP", "./ghr_len",
+     {TIMING_OPTIONS, TRIAL_OPTIONS, RESULT_OPTIONS, {"address", 'a', OPT_VALUE}, {"mode", 'm', OPT_VALUE},
+      {"batch_target", 'B', OPT_VALUE}, {"dummies", 'd', OPT_VALUE}, {"seed", 'S', OPT_VALUE}}},
+    {"btb_index", "BTB/Index", "./index",
+     {TIMING_OPTIONS, TRIAL_OPTIONS, SWEEP_OPTIONS, RESULT_OPTIONS, {"address", 'a', OPT_VALUE},
+      {"index_bits", 'b', OPT_VALUE}, {"copies", 'N', OPT_VALUE}}},
+    {"btb_ways", "BTB/Ways", "./associativity",
+     {TIMING_OPTIONS, TRIAL_OPTIONS, SWEEP_OPTIONS, RESULT_OPTIONS, {"address", 'a', OPT_VALUE},
+      {"branch_nums", 'b', OPT_VALUE}, {"stride_bits", 's', OPT_VALUE}}},
+    {"btb_size", "BTB/Size", "./btb_size",
+     {TIMING_OPTIONS, SWEEP_OPTIONS, RESULT_OPTIONS, {"iterations", 'i', OPT_VALUE}, {"repeats", 'r', OPT_VALUE},
+      {"distances", 'd', OPT_VALUE}, {"branches", 'b', OPT_VALUE}}},
+    {"btb_sim", "sim", "./btbsim",
+     {RESULT_OPTIONS, {"layout", 'x', OPT_VALUE}, {"values", 'b', OPT_VALUE}, {"copies", 'N', OPT_VALUE},
+      {"stride_bits", 's', OPT_VALUE}, {"distances", 'd', OPT_VALUE}, {"iterations", 'i', OPT_VALUE},
+      {"object", 'e', OPT_PATH}, {"sets", 'S', OPT_VALUE}, {"ways", 'W', OPT_VALUE}, {"index_shift", 'I', OPT_VALUE},
+      {"tag_bits", 'T', OPT_VALUE}, {"hash", 'H', OPT_VALUE}, {"policy", 'p', OPT_VALUE}, {"penalty", 'm', OPT_VALUE},
+      {"seed", 'r', OPT_VALUE}, {"verbose", 'v', OPT_SWITCH}, {"trace", 't', OPT_PATH}}},
+    {"cbp_sim", "sim", "./cbpsim",
+     {RESULT_OPTIONS, {"model", 'm', OPT_VALUE}, {"table_bits", 'T', OPT_VALUE}, {"history", 'h', OPT_VALUE},
+      {"min_history", 'l', OPT_VALUE}, {"tables", 'N', OPT_VALUE}, {"tag_bits", 'G', OPT_VALUE},
+      {"update", 'g', OPT_VALUE}, {"harness", 'H', OPT_VALUE}, {"dummies", 'd', OPT_VALUE}, {"trials", 'n', OPT_VALUE},
+      {"warmup", 'w', OPT_VALUE}, {"object", 'e', OPT_PATH}, {"seed", 'r', OPT_VALUE}, {"trace", 't', OPT_PATH}}},
+    {"replay", "sim", "./replay",
+     {RESULT_OPTIONS, {"trace", 'i', OPT_PATH}, {"sets", 'S', OPT_VALUE}, {"ways", 'W', OPT_VALUE},
+      {"index_shift", 'I', OPT_VALUE}, {"tag_bits", 'T', OPT_VALUE}, {"hash", 'H', OPT_VALUE},
+      {"policy", 'p', OPT_VALUE}, {"seed", 'r', OPT_VALUE}, {"model", 'm', OPT_VALUE}, {"table_bits", 'B', OPT_VALUE},
+      {"history", 'h', OPT_VALUE}, {"min_history", 'l', OPT_VALUE}, {"tables", 'N', OPT_VALUE},
+      {"cbp_tag_bits", 'G', OPT_VALUE}, {"update", 'g', OPT_VALUE}, {"max_records", 'n', OPT_VALUE},
+      {"dump", 'd', OPT_SWITCH}}},
+    {"batch_sim", "sim", "./batchsim",
+     {RESULT_OPTIONS, {"trace", 'i', OPT_PATH}, {"table_bits", 'B', OPT_VALUE}, {"history", 'h', OPT_VALUE},
+      {"update", 'g', OPT_VALUE}, {"kernel", 'k', OPT_VALUE}, {"max_records", 'n', OPT_VALUE},
+      {"check", 'c', OPT_SWITCH}}},
+    {"dse", "sim", "./dse",
+     {RESULT_OPTIONS, {"traces", 'i', OPT_PATHS}, {"family", 'x', OPT_VALUE}, {"sets", 'S', OPT_VALUE},
+      {"ways", 'W', OPT_VALUE}, {"hash", 'H', OPT_VALUE}, {"index_shift", 'I', OPT_VALUE},
+      {"tag_bits", 'T', OPT_VALUE}, {"policy", 'p', OPT_VALUE}, {"model", 'm', OPT_VALUE},
+      {"table_bits", 'B', OPT_VALUE}, {"history", 'h', OPT_VALUE}, {"min_history", 'l', OPT_VALUE},
+      {"tables", 'N', OPT_VALUE}, {"cbp_tag_bits", 'G', OPT_VALUE}, {"update", 'g', OPT_VALUE},
+      {"cpus", 'j', OPT_VALUE}, {"reserve", 'k', OPT_SWITCH}, {"chunk_blocks", 'C', OPT_VALUE},
+      {"warmup_blocks", 'w', OPT_VALUE}}},
+};
+
+#define NUM_EXPERIMENTS (sizeof(experiments) / sizeof(experiments[0]))
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-n] spec [key=value ...]\n", prog);
+    fprintf(stderr, "       %s -l\n", prog);
+    fprintf(stderr, "       %s analyze results.csv [x=column] [y=column] [ci=column] [group=column] [expect=value]\n",
+            prog);
+    fprintf(stderr, "  -n  print the command instead of running it\n");
+    fprintf(stderr, "  -l  list experiments and the keys they accept\n");
+    exit(EXIT_FAILURE);
+}
+
+static void list_experiments(void)
+{
+    for (size_t i = 0; i < NUM_EXPERIMENTS; i++)
+    {
+        printf("%s (%s/%s):", experiments[i].name, experiments[i].dir, experiments[i].binary + 2);
+        for (const struct option_map *o = experiments[i].options; o->key; o++)
+            printf(" %s", o->key);
+        printf(" output root\n");
+    }
+}
+
+static const struct experiment *find_experiment(const char *name)
+{
+    for (size_t i = 0; i < NUM_EXPERIMENTS; i++)
+        if (strcmp(experiments[i].name, name) == 0)
+            return &experiments[i];
+    return NULL;
+}
+
+// Directory holding this executable; experiment directories are found relative to it
+static void default_root(char *root, size_t size)
+{
+    char self[PATH_MAX];
+    ssize_t n = readlink("/proc/self/exe", self, sizeof(self) - 1);
+
+    if (n < 0)
+    {
+        snprintf(root, size, ".");
+        return;
+    }
+    self[n] = '\0';
+    snprintf(root, size, "%s", dirname(self));
+}
+
+int main(int argc, char **argv)
+{
+    struct spec spec;
+    int dry_run = 0;
+    int opt;
+
+    if (argc > 1 && strcmp(argv[1], "analyze") == 0)
+        return analyze(argc - 1, argv + 1);
+
+    while ((opt = getopt(argc, argv, "nl")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            dry_run = 1;
+            break;
+        case 'l':
+            list_experiments();
+            return 0;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (optind >= argc)
+        usage(argv[0]);
+
+    // The spec file first, then key=value overrides from the command line
+    spec_init(&spec);
+    spec_load(&spec, argv[optind]);
+    for (int i = optind + 1; i < argc; i++)
+    {
+        if (spec_set(&spec, argv[i], "command line", i - optind) < 0)
+        {
+            fprintf(stderr, "Expected key=value: %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    const char *name = spec_get(&spec, "experiment");
+    if (!name)
+    {
+        fprintf(stderr, "%s: no experiment given\n", argv[optind]);
+        return EXIT_FAILURE;
+    }
+    const struct experiment *exp = find_experiment(name);
+    if (!exp)
+    {
+        fprintf(stderr, "Unknown experiment: %s (bpure -l lists them)\n", name);
+        return EXIT_FAILURE;
+    }
+
+    // Translate the keys into the experiment's own flags
+    char *args[MAX_ARGS];
+    char flags[MAX_OPTIONS][3];
+    char paths[MAX_OPTIONS][PATH_MAX];
+    char cwd[PATH_MAX];
+    int nargs = 0;
+
+    args[nargs++] = (char *)exp->binary;
+    for (int i = 0; i < MAX_OPTIONS && exp->options[i].key; i++)
+    {
+        const struct option_map *o = &exp->options[i];
+        const char *value = spec_get(&spec, o->key);
+
+        if (!value)
+            continue;
+        snprintf(flags[i], sizeof(flags[i]), "-%c", o->flag);
+        if (o->kind == OPT_SWITCH)
+        {
+            if (spec_get_bool(&spec, o->key, 0))
+                args[nargs++] = flags[i];
+            continue;
+        }
+        if (o->kind == OPT_PATH && value[0] != '/')
+        {
+            if (!getcwd(cwd, sizeof(cwd)))
+            {
+                perror("getcwd");
+                return EXIT_FAILURE;
+            }
+            if (snprintf(paths[i], sizeof(paths[i]), "%s/%s", cwd, value) >= (int)sizeof(paths[i]))
+            {
+                fprintf(stderr, "Path too long: %s\n", value);
+                return EXIT_FAILURE;
+            }
+            value = paths[i];
+        }
+        else if (o->kind == OPT_PATHS)
+        {
+            size_t len = 0;
+
+            if (!getcwd(cwd, sizeof(cwd)))
+            {
+                perror("getcwd");
+                return EXIT_FAILURE;
+            }
+            for (const char *p = value; *p;)
+            {
+                size_t n = strcspn(p, ",");
+                int w = snprintf(paths[i] + len, sizeof(paths[i]) - len, "%s%s%s%.*s", len ? "," : "",
+                                 p[0] == '/' ? "" : cwd, p[0] == '/' ? "" : "/", (int)n, p);
+
+                if (w >= (int)(sizeof(paths[i]) - len))
+                {
+                    fprintf(stderr, "Paths too long: %s\n", value);
+                    return EXIT_FAILURE;
+                }
+                len += w;
+                p += n + (p[n] == ',');
+            }
+            value = paths[i];
+        }
+        args[nargs++] = flags[i];
+        args[nargs++] = (char *)value;
+    }
+    args[nargs] = NULL;
+
+    char root[PATH_MAX];
+    const char *output = spec_get(&spec, "output");
+    const char *root_key = spec_get(&spec, "root");
+
+    if (root_key)
+        snprintf(root, sizeof(root), "%s", root_key);
+    else
+        default_root(root, sizeof(root));
+
+    if (spec_report_unused(&spec, stderr))
+        return EXIT_FAILURE;
+
+    if (dry_run)
+    {
+        printf("cd %s/%s &&", root, exp->dir);
+        for (int i = 0; i < nargs; i++)
+            printf(" %s", args[i]);
+        if (output)
+            printf(" > %s", output);
+        printf("\n");
+        return 0;
+    }
+
+    // Opened before changing directory so a relative path is relative to where bpure was started
+    int out_fd = -1;
+    if (output)
+    {
+        out_fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (out_fd < 0)
+        {
+            perror(output);
+            return EXIT_FAILURE;
+        }
+    }
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        perror("fork");
+        return EXIT_FAILURE;
+    }
+    if (pid == 0)
+    {
+        if (chdir(root) < 0 || chdir(exp->dir) < 0)
+        {
+            fprintf(stderr, "%s/%s: %s\n", root, exp->dir, strerror(errno));
+            _exit(EXIT_FAILURE);
+        }
+        if (out_fd >= 0 && dup2(out_fd, STDOUT_FILENO) < 0)
+        {
+            perror("dup2");
+            _exit(EXIT_FAILURE);
+        }
+        execv(exp->binary, args);
+        fprintf(stderr, "%s/%s/%s: %s\n", root, exp->dir, exp->binary, strerror(errno));
+        _exit(EXIT_FAILURE);
+    }
+
+    int status;
+    if (waitpid(pid, &status, 0) < 0)
+    {
+        perror("waitpid");
+        return EXIT_FAILURE;
+    }
+    if (out_fd >= 0)
+        close(out_fd);
+
+    if (!WIFEXITED(status))
+    {
+        fprintf(stderr, "%s terminated by signal %d\n", exp->name, WTERMSIG(status));
+        return EXIT_FAILURE;
+    }
+    return WEXITSTATUS(status);
+}
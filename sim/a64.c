@@ -0,0 +1,138 @@
+#include <err.h>
+#include <stdlib.h>
+
+#include "a64.h"
+
+struct cpu
+{
+    uint64_t x[32]; // x[31] reads as zero
+    int n, z, c, v;
+};
+
+static int64_t sign_extend(uint32_t value, int bits)
+{
+    return (int64_t)((uint64_t)value << (64 - bits)) >> (64 - bits);
+}
+
+static int condition(const struct cpu *s, int cond)
+{
+    int result;
+
+    switch (cond >> 1)
+    {
+    case 0: // eq / ne
+        result = s->z;
+        break;
+    case 1: // hs / lo
+        result = s->c;
+        break;
+    case 2: // mi / pl
+        result = s->n;
+        break;
+    case 3: // vs / vc
+        result = s->v;
+        break;
+    case 4: // hi / ls
+        result = s->c && !s->z;
+        break;
+    case 5: // ge / lt
+        result = s->n == s->v;
+        break;
+    case 6: // gt / le
+        result = !s->z && s->n == s->v;
+        break;
+    default: // al
+        return 1;
+    }
+    return cond & 1 ? !result : result;
+}
+
+// subs rd, rn, #imm with its flags
+static void subs(struct cpu *s, uint32_t insn)
+{
+    int sf = insn >> 31, rd = insn & 31, rn = (insn >> 5) & 31;
+    uint64_t imm = (insn >> 10) & 0xfff;
+    uint64_t mask = sf ? UINT64_MAX : UINT32_MAX, sign = sf ? 1ULL << 63 : 1ULL << 31;
+    uint64_t a = (rn == 31 ? 0 : s->x[rn]) & mask;
+
+    if (insn & (1 << 22))
+        imm <<= 12;
+    uint64_t r = (a - imm) & mask;
+    s->n = (r & sign) != 0;
+    s->z = r == 0;
+    s->c = a >= imm;
+    s->v = ((a ^ imm) & (a ^ r) & sign) != 0;
+    if (rd != 31)
+        s->x[rd] = r;
+}
+
+uint64_t a64_run(const uint32_t *code, size_t len, uint64_t base, uint64_t arg, a64_branch_fn branch, void *ctx)
+{
+    struct cpu s = {{0}, 0, 0, 0, 0};
+    uint64_t calls[A64_MAX_CALLS];
+    int depth = 0;
+    size_t i = 0;
+
+    s.x[0] = arg;
+    for (long step = 0; step < A64_MAX_STEPS; step++)
+    {
+        if (i >= len)
+            errx(EXIT_FAILURE, "Execution left the code at %#lx", (unsigned long)(base + 4 * i));
+
+        uint32_t insn = code[i];
+        uint64_t pc = base + 4 * i;
+        int64_t offset = 0;
+        enum trace_kind kind = TRACE_JUMP;
+        int jump = 0;
+
+        if ((insn & 0x7c000000) == 0x14000000) // b, bl
+        {
+            offset = sign_extend(insn & 0x3ffffff, 26) * 4;
+            kind = insn >> 31 ? TRACE_CALL : TRACE_JUMP;
+            jump = 1;
+            if (insn >> 31)
+            {
+                if (depth == A64_MAX_CALLS)
+                    errx(EXIT_FAILURE, "Calls nest too deep at %#lx", (unsigned long)pc);
+                calls[depth++] = i + 1;
+            }
+        }
+        else if ((insn & 0xff000010) == 0x54000000) // b.cond
+        {
+            offset = sign_extend((insn >> 5) & 0x7ffff, 19) * 4;
+            kind = TRACE_COND;
+            jump = condition(&s, insn & 0xf);
+            if (!jump)
+                branch(pc, pc + offset, kind, 0, ctx);
+        }
+        else if ((insn & 0xfffffc1f) == 0xd65f0000) // ret
+        {
+            if (depth == 0)
+                return pc;
+            size_t back = calls[--depth];
+            branch(pc, base + 4 * back, TRACE_RET, 1, ctx);
+            i = back;
+            continue;
+        }
+        else if ((insn & 0x7f800000) == 0x52800000) // movz
+        {
+            int rd = insn & 31, hw = (insn >> 21) & 3;
+            if (rd != 31)
+                s.x[rd] = (uint64_t)((insn >> 5) & 0xffff) << (16 * hw);
+        }
+        else if ((insn & 0x7f800000) == 0x71000000) // subs immediate, cmp
+            subs(&s, insn);
+        else if ((insn & 0x7e000000) == 0x34000000 || (insn & 0x7e000000) == 0x36000000 ||
+                 (insn & 0xfe1f0000) == 0xd61f0000) // cbz, tbz, br / blr
+            errx(EXIT_FAILURE, "Cannot follow the branch %08x at %#lx", insn, (unsigned long)pc);
+
+        if (!jump)
+        {
+            i++;
+            continue;
+        }
+        branch(pc, pc + offset, kind, 1, ctx);
+        i = (size_t)((int64_t)i + offset / 4);
+    }
+    errx(EXIT_FAILURE, "No return after %ld instructions", A64_MAX_STEPS);
+}
@@ -0,0 +1,23 @@
+#ifndef A64_H
+#define A64_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "trace.h"
+
+#define A64_MAX_STEPS 100000000L // Instructions one run may execute before it is taken for a runaway loop
+#define A64_MAX_CALLS 64         // Depth of bl without a matching ret
+
+// Called for every branch executed, taken or not, in execution order. target is where a taken branch goes
+// and a not-taken b.cond would have gone.
+typedef void (*a64_branch_fn)(uint64_t pc, uint64_t target, enum trace_kind kind, int taken, void *ctx);
+
+// Execute code, placed at address base, from its first instruction with x0 = arg until it returns. Only
+// what decides control flow is modelled: b, bl, b.cond, ret, and the movz / subs (cmp) that lib/emit
+// writes for the conditions; every other instruction falls through. Exits on a branch it cannot follow.
+// The ret that leaves the code is not reported, its return address being the caller's; its address is
+// returned instead.
+uint64_t a64_run(const uint32_t *code, size_t len, uint64_t base, uint64_t arg, a64_branch_fn branch, void *ctx);
+
+#endif
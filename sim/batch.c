@@ -0,0 +1,306 @@
+#include <err.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "batch.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+static const char *kernel_names[] = {"scalar", "neon", "avx2"};
+
+enum batch_kernel batch_best_kernel(void)
+{
+#if defined(__ARM_NEON)
+    return BATCH_NEON;
+#elif defined(__x86_64__)
+    return __builtin_cpu_supports("avx2") ? BATCH_AVX2 : BATCH_SCALAR;
+#else
+    return BATCH_SCALAR;
+#endif
+}
+
+const char *batch_kernel_name(enum batch_kernel kernel)
+{
+    return kernel_names[kernel];
+}
+
+void batch_init(struct batch *b, enum cbp_update update, enum batch_kernel kernel)
+{
+#if !defined(__ARM_NEON)
+    if (kernel == BATCH_NEON)
+        errx(EXIT_FAILURE, "The NEON kernel needs an ARM build");
+#endif
+#if !defined(__x86_64__)
+    if (kernel == BATCH_AVX2)
+        errx(EXIT_FAILURE, "The AVX2 kernel needs an x86-64 build");
+#else
+    if (kernel == BATCH_AVX2 && !__builtin_cpu_supports("avx2"))
+        errx(EXIT_FAILURE, "This CPU has no AVX2");
+#endif
+
+    memset(b, 0, sizeof(*b));
+    b->update = update;
+    b->kernel = kernel;
+}
+
+void batch_add(struct batch *b, int table_bits, int history)
+{
+    if (b->num == BATCH_MAX)
+        errx(EXIT_FAILURE, "More than %d configurations in one batch", BATCH_MAX);
+    if (table_bits < 1 || table_bits > 24)
+        errx(EXIT_FAILURE, "Table bits must be between 1 and 24: %d", table_bits);
+    if (history < 0 || history >= BATCH_HISTORY)
+        errx(EXIT_FAILURE, "History must be between 0 and %d: %d", BATCH_HISTORY - 1, history);
+
+    b->table_bits[b->num] = table_bits;
+    b->history[b->num] = history;
+    b->num++;
+}
+
+void batch_start(struct batch *b)
+{
+    size_t size = 0;
+
+    b->padded = (b->num + BATCH_LANES - 1) / BATCH_LANES * BATCH_LANES;
+    for (int i = 0; i < b->padded; i++)
+    {
+        int bits = i < b->num ? b->table_bits[i] : 0;
+
+        b->base[i] = size;
+        b->mask[i] = (1U << bits) - 1;
+        b->width[i] = bits ? bits : 1;
+        b->length[i] = i < b->num ? b->history[i] : 0;
+        b->shift[i] = b->length[i] % b->width[i];
+        size += (size_t)1 << bits;
+    }
+    // The AVX2 gather takes its indices as signed 32-bit offsets
+    if (size > INT32_MAX)
+        errx(EXIT_FAILURE, "The tables of one batch must fit in 2 GB");
+
+    // Vector kernels load 4 bytes at each counter
+    free(b->counters);
+    b->counters_size = size;
+    b->counters = malloc(size + 3);
+    if (!b->counters)
+        err(EXIT_FAILURE, "Unable to allocate the batch tables");
+    memset(b->counters, 2, size + 3);
+
+    memset(b->fold, 0, sizeof(b->fold));
+    memset(b->misses, 0, sizeof(b->misses));
+    memset(b->mispredicts, 0, sizeof(b->mispredicts));
+    memset(b->ghr, 0, sizeof(b->ghr));
+    b->head = 0;
+    b->conditionals = b->pending = 0;
+}
+
+static void predict_scalar(struct batch *b, uint32_t pc, int taken)
+{
+    for (int i = 0; i < b->padded; i++)
+    {
+        uint8_t *ctr = &b->counters[b->base[i] + ((pc ^ b->fold[i]) & b->mask[i])];
+
+        b->misses[i] += (*ctr >= 2) != taken;
+        if (taken && *ctr < 3)
+            (*ctr)++;
+        else if (!taken && *ctr > 0)
+            (*ctr)--;
+    }
+}
+
+// As fold_push in cbp.c, for every configuration
+static void push_scalar(struct batch *b)
+{
+    uint32_t newest = b->ghr[b->head];
+
+    for (int i = 0; i < b->padded; i++)
+    {
+        uint32_t fold = (b->fold[i] << 1) | newest;
+
+        fold ^= b->ghr[(b->head + b->length[i]) % BATCH_HISTORY] << b->shift[i];
+        fold ^= fold >> b->width[i];
+        b->fold[i] = fold & b->mask[i];
+    }
+}
+
+#if defined(__x86_64__)
+__attribute__((target("avx2"))) static void predict_avx2(struct batch *b, uint32_t pc, int taken)
+{
+    const __m256i vpc = _mm256_set1_epi32(pc), one = _mm256_set1_epi32(1), three = _mm256_set1_epi32(3);
+    const __m256i byte = _mm256_set1_epi32(0xff), zero = _mm256_setzero_si256();
+    const __m256i outcome = _mm256_set1_epi32(taken ? -1 : 0);
+    uint32_t index[BATCH_LANES] __attribute__((aligned(32))), value[BATCH_LANES] __attribute__((aligned(32)));
+
+    for (int i = 0; i < b->padded; i += BATCH_LANES)
+    {
+        __m256i fold = _mm256_load_si256((const __m256i *)(b->fold + i));
+        __m256i mask = _mm256_load_si256((const __m256i *)(b->mask + i));
+        __m256i base = _mm256_load_si256((const __m256i *)(b->base + i));
+        __m256i idx = _mm256_add_epi32(_mm256_and_si256(_mm256_xor_si256(vpc, fold), mask), base);
+        __m256i ctr = _mm256_and_si256(_mm256_i32gather_epi32((const int *)b->counters, idx, 1), byte);
+
+        // Lanes that predicted wrong are all ones, i.e. -1
+        __m256i miss = _mm256_xor_si256(_mm256_cmpgt_epi32(ctr, one), outcome);
+        __m256i misses = _mm256_load_si256((const __m256i *)(b->misses + i));
+        _mm256_store_si256((__m256i *)(b->misses + i), _mm256_sub_epi32(misses, miss));
+
+        ctr = taken ? _mm256_min_epi32(_mm256_add_epi32(ctr, one), three)
+                    : _mm256_max_epi32(_mm256_sub_epi32(ctr, one), zero);
+        _mm256_store_si256((__m256i *)index, idx);
+        _mm256_store_si256((__m256i *)value, ctr);
+        for (int k = 0; k < BATCH_LANES; k++)
+            b->counters[index[k]] = value[k];
+    }
+}
+
+__attribute__((target("avx2"))) static void push_avx2(struct batch *b)
+{
+    const __m256i newest = _mm256_set1_epi32(b->ghr[b->head]), head = _mm256_set1_epi32(b->head);
+    const __m256i wrap = _mm256_set1_epi32(BATCH_HISTORY - 1);
+
+    for (int i = 0; i < b->padded; i += BATCH_LANES)
+    {
+        __m256i length = _mm256_load_si256((const __m256i *)(b->length + i));
+        __m256i oldest = _mm256_i32gather_epi32((const int *)b->ghr,
+                                                _mm256_and_si256(_mm256_add_epi32(head, length), wrap), 4);
+        __m256i fold = _mm256_or_si256(_mm256_slli_epi32(_mm256_load_si256((const __m256i *)(b->fold + i)), 1),
+                                       newest);
+
+        fold = _mm256_xor_si256(fold, _mm256_sllv_epi32(oldest, _mm256_load_si256((const __m256i *)(b->shift + i))));
+        fold = _mm256_xor_si256(fold, _mm256_srlv_epi32(fold, _mm256_load_si256((const __m256i *)(b->width + i))));
+        fold = _mm256_and_si256(fold, _mm256_load_si256((const __m256i *)(b->mask + i)));
+        _mm256_store_si256((__m256i *)(b->fold + i), fold);
+    }
+}
+#endif
+
+#if defined(__ARM_NEON)
+// NEON has no gather: indices and new counters are computed four lanes at a time, the loads are scalar
+static void predict_neon(struct batch *b, uint32_t pc, int taken)
+{
+    const uint32x4_t vpc = vdupq_n_u32(pc), one = vdupq_n_u32(1), three = vdupq_n_u32(3);
+    const uint32x4_t outcome = vdupq_n_u32(taken ? UINT32_MAX : 0);
+    uint32_t index[4], value[4];
+
+    for (int i = 0; i < b->padded; i += 4)
+    {
+        uint32x4_t idx = vaddq_u32(vandq_u32(veorq_u32(vpc, vld1q_u32(b->fold + i)), vld1q_u32(b->mask + i)),
+                                   vld1q_u32(b->base + i));
+        vst1q_u32(index, idx);
+        for (int k = 0; k < 4; k++)
+            value[k] = b->counters[index[k]];
+
+        uint32x4_t ctr = vld1q_u32(value);
+        uint32x4_t miss = veorq_u32(vcgtq_u32(ctr, one), outcome);
+        vst1q_u32(b->misses + i, vsubq_u32(vld1q_u32(b->misses + i), miss));
+
+        ctr = taken ? vminq_u32(vaddq_u32(ctr, one), three) : vqsubq_u32(ctr, one);
+        vst1q_u32(value, ctr);
+        for (int k = 0; k < 4; k++)
+            b->counters[index[k]] = value[k];
+    }
+}
+
+static void push_neon(struct batch *b)
+{
+    const uint32x4_t newest = vdupq_n_u32(b->ghr[b->head]);
+    uint32_t oldest[4];
+
+    for (int i = 0; i < b->padded; i += 4)
+    {
+        for (int k = 0; k < 4; k++)
+            oldest[k] = b->ghr[(b->head + b->length[i + k]) % BATCH_HISTORY];
+
+        uint32x4_t fold = vorrq_u32(vshlq_n_u32(vld1q_u32(b->fold + i), 1), newest);
+        fold = veorq_u32(fold, vshlq_u32(vld1q_u32(oldest), vreinterpretq_s32_u32(vld1q_u32(b->shift + i))));
+        // A negative shift count shifts right
+        fold = veorq_u32(fold, vshlq_u32(fold, vnegq_s32(vreinterpretq_s32_u32(vld1q_u32(b->width + i)))));
+        vst1q_u32(b->fold + i, vandq_u32(fold, vld1q_u32(b->mask + i)));
+    }
+}
+#endif
+
+static void history_push(struct batch *b, uint32_t bit)
+{
+    b->head = (b->head + BATCH_HISTORY - 1) % BATCH_HISTORY;
+    b->ghr[b->head] = bit;
+
+    switch (b->kernel)
+    {
+#if defined(__ARM_NEON)
+    case BATCH_NEON:
+        push_neon(b);
+        break;
+#endif
+#if defined(__x86_64__)
+    case BATCH_AVX2:
+        push_avx2(b);
+        break;
+#endif
+    default:
+        push_scalar(b);
+        break;
+    }
+}
+
+void batch_branch(struct batch *b, uint64_t pc, uint64_t target, int conditional, int taken)
+{
+    if (conditional)
+    {
+        switch (b->kernel)
+        {
+#if defined(__ARM_NEON)
+        case BATCH_NEON:
+            predict_neon(b, pc >> 2, taken);
+            break;
+#endif
+#if defined(__x86_64__)
+        case BATCH_AVX2:
+            predict_avx2(b, pc >> 2, taken);
+            break;
+#endif
+        default:
+            predict_scalar(b, pc >> 2, taken);
+            break;
+        }
+        b->conditionals++;
+        if (++b->pending == BATCH_FLUSH)
+            batch_flush(b);
+    }
+
+    // The same history as cbp_branch
+    switch (b->update)
+    {
+    case CBP_UPDATE_COND:
+        if (conditional)
+            history_push(b, taken);
+        break;
+    case CBP_UPDATE_ALL:
+        history_push(b, conditional ? taken : 1);
+        break;
+    case CBP_UPDATE_PATH:
+        if (taken)
+            history_push(b, __builtin_parityll((pc >> 2) ^ (target >> 3)));
+        break;
+    }
+}
+
+void batch_flush(struct batch *b)
+{
+    for (int i = 0; i < b->padded; i++)
+    {
+        b->mispredicts[i] += b->misses[i];
+        b->misses[i] = 0;
+    }
+    b->pending = 0;
+}
+
+void batch_free(struct batch *b)
+{
+    free(b->counters);
+    b->counters = NULL;
+}
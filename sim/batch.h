@@ -0,0 +1,71 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdint.h>
+
+#include "cbp.h"
+
+#define BATCH_MAX 256           // Configurations in one batch
+#define BATCH_LANES 8           // Configurations one vector step advances, for the widest kernel
+#define BATCH_HISTORY 2048      // Global history kept, a power of two
+#define BATCH_FLUSH (1L << 30)  // Conditional branches before the 32-bit lane counts go into the totals
+
+enum batch_kernel
+{
+    BATCH_SCALAR, // The reference: one configuration at a time, plain C
+    BATCH_NEON,
+    BATCH_AVX2,
+};
+
+// Many gshare configurations (bimodal with no history) advanced together over one branch stream. The
+// history is the same for all of them, so it is kept once; everything else is an array with one element
+// per configuration, so that a vector kernel computes the index, prediction and new counter of
+// BATCH_LANES configurations at once. Only writing the counters back is done lane by lane, as neither
+// NEON nor AVX2 has a scatter. Every kernel gives the same counts as cbp with the same configuration.
+struct batch
+{
+    int num;                // Configurations added
+    int padded;             // num rounded up to BATCH_LANES; the extra lanes use a one-entry table
+    enum cbp_update update; // Shared by all configurations
+    enum batch_kernel kernel;
+    int table_bits[BATCH_MAX], history[BATCH_MAX];
+
+    // One element per configuration
+    uint32_t mask[BATCH_MAX] __attribute__((aligned(32)));  // Table entries - 1
+    uint32_t base[BATCH_MAX] __attribute__((aligned(32)));  // Offset of the table in counters
+    uint32_t fold[BATCH_MAX] __attribute__((aligned(32)));  // History folded into table_bits
+    uint32_t length[BATCH_MAX] __attribute__((aligned(32))); // history
+    uint32_t shift[BATCH_MAX] __attribute__((aligned(32)));  // history % table_bits, where the oldest bit went
+    uint32_t width[BATCH_MAX] __attribute__((aligned(32)));  // table_bits
+    uint32_t misses[BATCH_MAX] __attribute__((aligned(32))); // Since the last flush
+    uint64_t mispredicts[BATCH_MAX];
+
+    uint8_t *counters; // All tables back to back, 0..3
+    size_t counters_size;
+    uint32_t ghr[BATCH_HISTORY]; // Bit i back is ghr[(head + i) % BATCH_HISTORY]
+    uint32_t head;
+    long conditionals, pending;
+};
+
+// The fastest kernel this CPU runs
+enum batch_kernel batch_best_kernel(void);
+
+const char *batch_kernel_name(enum batch_kernel kernel);
+
+void batch_init(struct batch *b, enum cbp_update update, enum batch_kernel kernel);
+
+// Add a configuration; exits when the batch is full or the configuration invalid
+void batch_add(struct batch *b, int table_bits, int history);
+
+// Allocate the tables of the configurations added and reset all state
+void batch_start(struct batch *b);
+
+// One executed branch for every configuration
+void batch_branch(struct batch *b, uint64_t pc, uint64_t target, int conditional, int taken);
+
+// Move the lane counts into mispredicts
+void batch_flush(struct batch *b);
+
+void batch_free(struct batch *b);
+
+#endif
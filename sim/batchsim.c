@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "batch.h"
+#include "bpure.h"
+#include "cbp.h"
+#include "sink.h"
+#include "trace.h"
+
+#define MAX_RANGE_LEN 256
+#define DEFAULT_TABLE_BITS "8..16"
+#define DEFAULT_HISTORY "0..32:2"
+
+struct batch batch;
+struct sink sink;
+int col_table_bits, col_history, col_conditionals, col_mispredicts, col_rate;
+
+double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// One pass over the trace for every configuration of the batch; returns the records read
+uint64_t run_batch(const struct trace *t, uint64_t max_records)
+{
+    struct trace_cursor c;
+    struct trace_record r;
+    uint64_t n = 0;
+
+    batch_start(&batch);
+    trace_seek(t, &c, 0, t->header->blocks);
+    while ((!max_records || n < max_records) && trace_next(&c, &r))
+    {
+        batch_branch(&batch, r.pc, r.target, r.kind == TRACE_COND, r.taken);
+        n++;
+    }
+    batch_flush(&batch);
+    return n;
+}
+
+// The same configuration through the gshare of cbp.c, one branch at a time
+long reference(const struct trace *t, uint64_t max_records, int table_bits, int history, enum cbp_update update)
+{
+    struct cbp_config cfg = {CBP_GSHARE, table_bits, history, 1, 1, 2, update};
+    struct trace_cursor c;
+    struct trace_record r;
+    struct cbp p;
+    uint64_t n = 0;
+
+    cbp_init(&p, &cfg);
+    trace_seek(t, &c, 0, t->header->blocks);
+    while ((!max_records || n < max_records) && trace_next(&c, &r))
+    {
+        cbp_branch(&p, r.pc, r.target, r.kind == TRACE_COND, r.taken);
+        n++;
+    }
+    long mispredicts = p.mispredicts;
+    cbp_free(&p);
+    return mispredicts;
+}
+
+void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s -i trace [-B table_bits] [-h history] [-g cond|all|path] [-k auto|scalar|neon|avx2] "
+            "[-n max_records] [-c] [-o results [-f csv|jsonl|bin]]\n",
+            prog);
+    fprintf(stderr, "  -B and -h are ranges; every combination is simulated\n");
+    fprintf(stderr, "  -c checks every configuration against the one-at-a-time gshare model\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv)
+{
+    int table_bits[MAX_RANGE_LEN], history[MAX_RANGE_LEN];
+    int num_table_bits = parse_range(DEFAULT_TABLE_BITS, table_bits, MAX_RANGE_LEN);
+    int num_history = parse_range(DEFAULT_HISTORY, history, MAX_RANGE_LEN);
+    const char *path = NULL, *update = "cond", *kernel = "auto", *results_path = NULL, *results_format = NULL;
+    uint64_t max_records = 0;
+    enum cbp_update mode;
+    enum batch_kernel k;
+    int check = 0, failed = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:B:h:g:k:n:co:f:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'i':
+            path = optarg;
+            break;
+        case 'B':
+            num_table_bits = parse_range(optarg, table_bits, MAX_RANGE_LEN);
+            break;
+        case 'h':
+            num_history = parse_range(optarg, history, MAX_RANGE_LEN);
+            break;
+        case 'g':
+            update = optarg;
+            break;
+        case 'k':
+            kernel = optarg;
+            break;
+        case 'n':
+            max_records = strtoull(optarg, NULL, 0);
+            break;
+        case 'c':
+            check = 1;
+            break;
+        case 'o':
+            results_path = optarg;
+            break;
+        case 'f':
+            results_format = optarg;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+
+    if (!path)
+        usage(argv[0]);
+    if (strcmp(update, "cond") == 0)
+        mode = CBP_UPDATE_COND;
+    else if (strcmp(update, "all") == 0)
+        mode = CBP_UPDATE_ALL;
+    else if (strcmp(update, "path") == 0)
+        mode = CBP_UPDATE_PATH;
+    else
+        usage(argv[0]);
+    if (strcmp(kernel, "auto") == 0)
+        k = batch_best_kernel();
+    else if (strcmp(kernel, "scalar") == 0)
+        k = BATCH_SCALAR;
+    else if (strcmp(kernel, "neon") == 0)
+        k = BATCH_NEON;
+    else if (strcmp(kernel, "avx2") == 0)
+        k = BATCH_AVX2;
+    else
+        usage(argv[0]);
+
+    struct trace t;
+    trace_open(&t, path);
+
+    int num_configs = num_table_bits * num_history;
+    printf("Trace: %lu records; %d gshare configurations, %s history, %s kernel, up to %d per pass\n",
+           (unsigned long)t.header->records, num_configs, update, batch_kernel_name(k), BATCH_MAX);
+
+    sink_open(&sink, results_path, results_format);
+    col_table_bits = sink_column(&sink, "table_bits", SINK_INT);
+    col_history = sink_column(&sink, "history", SINK_INT);
+    col_conditionals = sink_column(&sink, "conditionals", SINK_INT);
+    col_mispredicts = sink_column(&sink, "mispredicts", SINK_INT);
+    col_rate = sink_column(&sink, "mispredict_rate", SINK_FLOAT);
+    sink_meta_system(&sink, 0, argc, argv);
+    sink_meta(&sink, "experiment", "batch");
+    sink_meta(&sink, "trace", "%s", path);
+    sink_meta(&sink, "update", "%s", update);
+    sink_meta(&sink, "kernel", "%s", batch_kernel_name(k));
+    sink_start(&sink);
+
+    double seconds = 0, simulated = 0;
+    for (int first = 0; first < num_configs; first += BATCH_MAX)
+    {
+        int last = first + BATCH_MAX < num_configs ? first + BATCH_MAX : num_configs;
+
+        batch_init(&batch, mode, k);
+        for (int i = first; i < last; i++)
+            batch_add(&batch, table_bits[i / num_history], history[i % num_history]);
+
+        double start = now();
+        uint64_t n = run_batch(&t, max_records);
+        seconds += now() - start;
+        simulated += (double)n * batch.num;
+
+        for (int i = 0; i < batch.num; i++)
+        {
+            printf("Table bits: %d, History: %d, Mispredicts: %lu of %ld (%.2f%%)", batch.table_bits[i],
+                   batch.history[i], (unsigned long)batch.mispredicts[i], batch.conditionals,
+                   batch.conditionals ? 100.0 * batch.mispredicts[i] / batch.conditionals : 0.0);
+            if (check)
+            {
+                long expected = reference(&t, max_records, batch.table_bits[i], batch.history[i], mode);
+
+                if (expected == (long)batch.mispredicts[i])
+                    printf(", checked");
+                else
+                {
+                    printf(", MISMATCH: reference %ld", expected);
+                    failed = 1;
+                }
+            }
+            printf("\n");
+
+            sink_int(&sink, col_table_bits, batch.table_bits[i]);
+            sink_int(&sink, col_history, batch.history[i]);
+            sink_int(&sink, col_conditionals, batch.conditionals);
+            sink_int(&sink, col_mispredicts, batch.mispredicts[i]);
+            sink_float(&sink, col_rate, batch.conditionals ? (double)batch.mispredicts[i] / batch.conditionals : 0);
+            sink_emit(&sink);
+        }
+        batch_free(&batch);
+    }
+
+    printf("Simulated %.0f branch-configurations in %.3f s: %.1f M per second\n", simulated, seconds,
+           seconds > 0 ? simulated / seconds / 1e6 : 0.0);
+
+    sink_close(&sink);
+    trace_close(&t);
+    return failed ? EXIT_FAILURE : 0;
+}
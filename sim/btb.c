@@ -0,0 +1,108 @@
+#include <err.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "btb.h"
+
+void btb_init(struct btb *b, const struct btb_config *cfg)
+{
+    if (cfg->sets < 1 || (cfg->sets & (cfg->sets - 1)) != 0)
+        errx(EXIT_FAILURE, "Number of sets must be a power of two: %d", cfg->sets);
+    if (cfg->ways < 1)
+        errx(EXIT_FAILURE, "Number of ways must be positive: %d", cfg->ways);
+    if (cfg->index_shift < 0 || cfg->tag_bits < 0 || cfg->tag_bits > 63)
+        errx(EXIT_FAILURE, "Invalid index shift %d or tag bits %d", cfg->index_shift, cfg->tag_bits);
+
+    memset(b, 0, sizeof(*b));
+    b->cfg = *cfg;
+    while ((1 << b->set_bits) < cfg->sets)
+        b->set_bits++;
+    b->entries = calloc((size_t)cfg->sets * cfg->ways, sizeof(struct btb_entry));
+    if (!b->entries)
+        err(EXIT_FAILURE, "Unable to allocate the BTB");
+    btb_reset(b);
+}
+
+void btb_reset(struct btb *b)
+{
+    memset(b->entries, 0, (size_t)b->cfg.sets * b->cfg.ways * sizeof(struct btb_entry));
+    b->clock = 0;
+    b->rng = b->cfg.seed ? b->cfg.seed : 1;
+    b->hits = b->misses = 0;
+}
+
+static int set_of(const struct btb *b, uint64_t pc)
+{
+    uint64_t index = pc >> b->cfg.index_shift;
+
+    if (b->cfg.hash == BTB_HASH_XOR)
+        index ^= index >> b->set_bits;
+    return index & (b->cfg.sets - 1);
+}
+
+static uint64_t tag_of(const struct btb *b, uint64_t pc)
+{
+    uint64_t tag = pc >> (b->cfg.index_shift + b->set_bits);
+
+    return b->cfg.tag_bits ? tag & ((1ULL << b->cfg.tag_bits) - 1) : tag;
+}
+
+static int victim(struct btb *b, struct btb_entry *set)
+{
+    int way = 0;
+
+    for (int w = 0; w < b->cfg.ways; w++)
+        if (!set[w].valid)
+            return w;
+
+    if (b->cfg.policy == BTB_RANDOM)
+    {
+        b->rng ^= b->rng << 13;
+        b->rng ^= b->rng >> 7;
+        b->rng ^= b->rng << 17;
+        return b->rng % b->cfg.ways;
+    }
+    // Oldest use for LRU, oldest fill for FIFO
+    for (int w = 1; w < b->cfg.ways; w++)
+        if (set[w].stamp < set[way].stamp)
+            way = w;
+    return way;
+}
+
+int btb_access(struct btb *b, uint64_t pc, uint64_t target)
+{
+    struct btb_entry *set = b->entries + (size_t)set_of(b, pc) * b->cfg.ways;
+    uint64_t tag = tag_of(b, pc);
+
+    b->clock++;
+    for (int w = 0; w < b->cfg.ways; w++)
+    {
+        if (!set[w].valid || set[w].tag != tag)
+            continue;
+        if (b->cfg.policy == BTB_LRU)
+            set[w].stamp = b->clock;
+        if (set[w].target == target)
+        {
+            b->hits++;
+            return 1;
+        }
+        // An aliasing branch owns the entry: mispredicted, and the entry is retargeted
+        set[w].target = target;
+        b->misses++;
+        return 0;
+    }
+
+    int w = victim(b, set);
+    set[w].valid = 1;
+    set[w].tag = tag;
+    set[w].target = target;
+    set[w].stamp = b->clock;
+    b->misses++;
+    return 0;
+}
+
+void btb_free(struct btb *b)
+{
+    free(b->entries);
+    b->entries = NULL;
+}
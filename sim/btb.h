@@ -0,0 +1,60 @@
+#ifndef BTB_H
+#define BTB_H
+
+#include <stdint.h>
+
+// How a branch address picks its set
+enum btb_hash
+{
+    BTB_HASH_BITS, // The set_bits address bits from index_shift up
+    BTB_HASH_XOR,  // Those bits xor the next set_bits above them
+};
+
+enum btb_policy
+{
+    BTB_LRU,
+    BTB_FIFO,
+    BTB_RANDOM,
+};
+
+struct btb_config
+{
+    int sets;        // Power of two
+    int ways;
+    int index_shift; // Lowest address bit of the index
+    int tag_bits;    // Bits of the address above the index kept as tag, 0 for all of them
+    enum btb_hash hash;
+    enum btb_policy policy;
+    uint64_t seed; // BTB_RANDOM victim choice
+};
+
+struct btb_entry
+{
+    uint64_t tag, target;
+    uint64_t stamp; // Last use (LRU) or fill (FIFO)
+    int valid;
+};
+
+// Set-associative branch target buffer. A lookup hits when the tag matches and the stored target is
+// the one the branch goes to; partial tags make aliasing branches hit each other's entry and miss.
+struct btb
+{
+    struct btb_config cfg;
+    int set_bits;
+    struct btb_entry *entries; // sets x ways
+    uint64_t clock, rng;
+    long hits, misses;
+};
+
+// Exits on an invalid configuration
+void btb_init(struct btb *b, const struct btb_config *cfg);
+
+// Invalidate every entry and clear the counts
+void btb_reset(struct btb *b);
+
+// Look up a taken branch and fill its entry on a miss; returns 1 on a hit
+int btb_access(struct btb *b, uint64_t pc, uint64_t target);
+
+void btb_free(struct btb *b);
+
+#endif
@@ -0,0 +1,383 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "a64.h"
+#include "bpure.h"
+#include "btb.h"
+#include "elfcache.h"
+#include "emit.h"
+#include "layout.h"
+#include "sink.h"
+#include "trace.h"
+
+#define TARGET_ADDRESS 0x10000000 // Where BTB/Index and BTB/Ways place their copies
+#define MAX_RANGE_LEN 4096
+#define MAX_COPIES 64
+#define DEFAULT_COPIES 17
+#define DEFAULT_STRIDE_BITS 26
+#define DEFAULT_ITERATIONS 4
+#define WARMUP_RUNS 2    // Unmeasured runs before the measured one, as the experiments warm up
+#define BRANCH_TICKS 1   // Cost of a taken branch that hits
+#define DEFAULT_PENALTY 8 // Extra cost of a miss
+
+// Which experiment's layouts are replayed
+enum layout
+{
+    LAYOUT_INDEX,
+    LAYOUT_WAYS,
+    LAYOUT_SIZE,
+};
+
+struct btb btb;
+struct sink sink;
+struct emit_buf eb;
+const uint32_t *func; // perform_branch, as placed by load_function and arena_place
+size_t func_len;
+int penalty = DEFAULT_PENALTY;
+int verbose = 0;
+int measuring = 0; // Runs after the warm-up, whose hits and misses are printed with -v
+long ticks;        // Of the run in progress
+struct trace_writer trace;
+const char *trace_path = NULL; // Every branch the model sees is also written here
+
+// Score one taken branch against the model
+void branch(uint64_t pc, uint64_t target, enum trace_kind kind, int taken, void *ctx)
+{
+    if (trace_path)
+        trace_write(&trace, pc, target, kind, taken);
+    if (!taken)
+        return;
+
+    int hit = btb_access(&btb, pc, target);
+
+    ticks += BRANCH_TICKS + (hit ? 0 : penalty);
+    if (verbose && measuring)
+        putchar(hit ? 'H' : 'M');
+}
+
+// Warm-up runs are not counted; the hit and miss counts are those of the measured run
+void measure_begin(void)
+{
+    btb.hits = btb.misses = 0;
+    ticks = 0;
+    measuring = 1;
+    if (verbose)
+        printf("  ");
+}
+
+void measure_end(void)
+{
+    measuring = 0;
+    if (verbose)
+        putchar('\n');
+}
+
+// One window of calls to `copies` copies of perform_branch spaced stride bytes apart; returns its ticks
+void run_copies(int copies, uint64_t stride)
+{
+    for (int j = 0; j < copies; j++)
+        a64_run(func, func_len, TARGET_ADDRESS + j * stride, 0, branch, NULL);
+}
+
+long simulate_copies(int copies, uint64_t stride)
+{
+    if (func_len * 4 > stride)
+    {
+        fprintf(stderr, "Function size %zu does not fit a stride of %lu bytes\n", func_len * 4,
+                (unsigned long)stride);
+        exit(EXIT_FAILURE);
+    }
+
+    btb_reset(&btb);
+    for (int r = 0; r < WARMUP_RUNS; r++)
+        run_copies(copies, stride);
+    measure_begin();
+    run_copies(copies, stride);
+    measure_end();
+    return ticks;
+}
+
+long simulate_loop(int dist, int branches, uint64_t iterations)
+{
+    const uint32_t *code = layout_loop(&eb, dist, branches);
+
+    // Placed at TARGET_ADDRESS; BTB/Size lets the kernel pick a page, which leaves the low bits the same
+    btb_reset(&btb);
+    for (int r = 0; r < WARMUP_RUNS; r++)
+        a64_run(code, eb.len, TARGET_ADDRESS, iterations, branch, NULL);
+    measure_begin();
+    a64_run(code, eb.len, TARGET_ADDRESS, iterations, branch, NULL);
+    measure_end();
+    return ticks;
+}
+
+// The experiments' own perform_branch from branch.o, or the same instructions emitted here so that no
+// AArch64 object is needed: b 1f; nop; 1: ret
+void load_branch(const char *object, struct elf_cache *cache)
+{
+    if (object)
+    {
+        elf_cache_open(cache, object);
+        const struct elf_span *span = elf_cache_get(cache, "perform_branch");
+        func = span->code;
+        func_len = span->size / 4;
+        return;
+    }
+
+    emit_init(&eb, NULL, 4096);
+    uint32_t *b = emit_b(&eb, NULL);
+    emit_nop(&eb);
+    emit_patch(b, emit_here(&eb));
+    emit_ret(&eb);
+    func = eb.code;
+    func_len = eb.len;
+}
+
+void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s -x index|ways|size [-b range] [-N copies] [-s stride_bits] [-d distances] [-i iterations] "
+            "[-e branch.o]\n"
+            "       [-S sets] [-W ways] [-I index_shift] [-T tag_bits] [-H bits|xor] [-p lru|fifo|random] "
+            "[-m penalty] [-r seed] [-v] [-t trace] [-o results [-f csv|jsonl|bin]]\n",
+            prog);
+    fprintf(stderr, "  -b is index_bits for index, branch_nums for ways and branches for size\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv)
+{
+    struct btb_config cfg = {64, 4, 2, 0, BTB_HASH_BITS, BTB_LRU, 1};
+    struct elf_cache cache;
+    int values[MAX_RANGE_LEN], dists[MAX_RANGE_LEN];
+    int num_values = 0, num_dists = 0;
+    int layout = -1, copies = DEFAULT_COPIES, stride_bits = DEFAULT_STRIDE_BITS;
+    uint64_t iterations = DEFAULT_ITERATIONS;
+    const char *object = NULL, *results_path = NULL, *results_format = NULL;
+    const char *hash = "bits", *policy = "lru";
+    int opt;
+
+    while ((opt = getopt(argc, argv, "x:b:N:s:d:i:e:S:W:I:T:H:p:m:r:vt:o:f:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'x':
+            layout = strcmp(optarg, "index") == 0 ? LAYOUT_INDEX
+                     : strcmp(optarg, "ways") == 0 ? LAYOUT_WAYS
+                     : strcmp(optarg, "size") == 0 ? LAYOUT_SIZE
+                                                   : -1;
+            if (layout < 0)
+                usage(argv[0]);
+            break;
+        case 'b':
+            num_values = parse_range(optarg, values, MAX_RANGE_LEN);
+            break;
+        case 'N':
+            copies = atoi(optarg);
+            break;
+        case 's':
+            stride_bits = atoi(optarg);
+            break;
+        case 'd':
+            num_dists = parse_range(optarg, dists, MAX_RANGE_LEN);
+            break;
+        case 'i':
+            iterations = strtoull(optarg, NULL, 0);
+            break;
+        case 'e':
+            object = optarg;
+            break;
+        case 'S':
+            cfg.sets = atoi(optarg);
+            break;
+        case 'W':
+            cfg.ways = atoi(optarg);
+            break;
+        case 'I':
+            cfg.index_shift = atoi(optarg);
+            break;
+        case 'T':
+            cfg.tag_bits = atoi(optarg);
+            break;
+        case 'H':
+            hash = optarg;
+            break;
+        case 'p':
+            policy = optarg;
+            break;
+        case 'm':
+            penalty = atoi(optarg);
+            break;
+        case 'r':
+            cfg.seed = strtoull(optarg, NULL, 0);
+            break;
+        case 'v':
+            verbose = 1;
+            break;
+        case 't':
+            trace_path = optarg;
+            break;
+        case 'o':
+            results_path = optarg;
+            break;
+        case 'f':
+            results_format = optarg;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+
+    if (layout < 0)
+        usage(argv[0]);
+    if (strcmp(hash, "bits") == 0)
+        cfg.hash = BTB_HASH_BITS;
+    else if (strcmp(hash, "xor") == 0)
+        cfg.hash = BTB_HASH_XOR;
+    else
+        usage(argv[0]);
+    if (strcmp(policy, "lru") == 0)
+        cfg.policy = BTB_LRU;
+    else if (strcmp(policy, "fifo") == 0)
+        cfg.policy = BTB_FIFO;
+    else if (strcmp(policy, "random") == 0)
+        cfg.policy = BTB_RANDOM;
+    else
+        usage(argv[0]);
+
+    // The experiments' default sweeps
+    if (num_values == 0)
+        num_values = parse_range(layout == LAYOUT_INDEX ? "4..26" : layout == LAYOUT_WAYS ? "2..20" : "512..8192*2",
+                                 values, MAX_RANGE_LEN);
+    if (layout == LAYOUT_SIZE && num_dists == 0)
+        num_dists = parse_range("16..64*2", dists, MAX_RANGE_LEN);
+    if (copies < 1 || copies > MAX_COPIES || stride_bits < 0 || stride_bits > 40 || iterations == 0)
+        usage(argv[0]);
+
+    btb_init(&btb, &cfg);
+    if (trace_path)
+        trace_create(&trace, trace_path);
+    if (layout == LAYOUT_SIZE)
+    {
+        int max_dist = 0, max_branches = 0;
+        for (int i = 0; i < num_dists; i++)
+        {
+            if (dists[i] < 12 || dists[i] % 4 != 0)
+            {
+                fprintf(stderr, "Distance must be a multiple of 4 and at least 12: %d\n", dists[i]);
+                return EXIT_FAILURE;
+            }
+            if (dists[i] > max_dist)
+                max_dist = dists[i];
+        }
+        for (int i = 0; i < num_values; i++)
+            if (values[i] > max_branches)
+                max_branches = values[i];
+        emit_init(&eb, NULL, (size_t)max_dist * max_branches + 64);
+    }
+    else
+        load_branch(object, &cache);
+
+    // Same columns and experiment name as the hardware runs, so both go through bpure analyze alike
+    static const char *names[] = {"btb_index", "btb_ways", "btb_size"};
+    int col[6];
+    sink_open(&sink, results_path, results_format);
+    switch (layout)
+    {
+    case LAYOUT_INDEX:
+        col[0] = sink_column(&sink, "index_bits", SINK_INT);
+        col[1] = sink_column(&sink, "cpu", SINK_INT);
+        col[2] = sink_column(&sink, "trials", SINK_INT);
+        col[3] = sink_column(&sink, "window_ticks", SINK_FLOAT);
+        col[4] = sink_column(&sink, "window_ci", SINK_FLOAT);
+        col[5] = sink_column(&sink, "net_ticks_per_branch", SINK_FLOAT);
+        break;
+    case LAYOUT_WAYS:
+        col[0] = sink_column(&sink, "branch_num", SINK_INT);
+        col[1] = sink_column(&sink, "cpu", SINK_INT);
+        col[2] = sink_column(&sink, "trials", SINK_INT);
+        col[3] = sink_column(&sink, "ticks_per_branch", SINK_FLOAT);
+        col[4] = sink_column(&sink, "ticks_per_branch_ci", SINK_FLOAT);
+        col[5] = sink_column(&sink, "net_ticks_per_branch", SINK_FLOAT);
+        break;
+    case LAYOUT_SIZE:
+        col[0] = sink_column(&sink, "distance", SINK_INT);
+        col[1] = sink_column(&sink, "branches", SINK_INT);
+        col[2] = sink_column(&sink, "cpu", SINK_INT);
+        col[3] = sink_column(&sink, "best_ticks", SINK_INT);
+        col[4] = sink_column(&sink, "average_ticks", SINK_FLOAT);
+        col[5] = sink_column(&sink, "ns_per_branch", SINK_FLOAT);
+        break;
+    }
+    sink_meta_system(&sink, 0, argc, argv);
+    sink_meta(&sink, "experiment", "%s", names[layout]);
+    sink_meta(&sink, "simulator", "sets=%d ways=%d index_shift=%d tag_bits=%d hash=%s policy=%s penalty=%d", cfg.sets,
+              cfg.ways, cfg.index_shift, cfg.tag_bits, hash, policy, penalty);
+    sink_meta(&sink, "function", "%s", object ? object : "built-in");
+    sink_start(&sink);
+
+    printf("BTB model: %d sets x %d ways, index from bit %d (%s), %d tag bits, %s, miss penalty %d\n", cfg.sets,
+           cfg.ways, cfg.index_shift, hash, cfg.tag_bits, policy, penalty);
+
+    for (int d = 0; d < (layout == LAYOUT_SIZE ? num_dists : 1); d++)
+    {
+        for (int i = 0; i < num_values; i++)
+        {
+            long window;
+
+            switch (layout)
+            {
+            case LAYOUT_INDEX:
+                window = simulate_copies(copies, (uint64_t)1 << values[i]);
+                printf("Index bits: %d, Window ticks: %ld, Misses: %ld of %ld\n", values[i], window, btb.misses,
+                       btb.hits + btb.misses);
+                sink_int(&sink, col[0], values[i]);
+                sink_int(&sink, col[2], 1);
+                sink_float(&sink, col[3], window);
+                sink_float(&sink, col[5], (double)window / copies);
+                break;
+            case LAYOUT_WAYS:
+                if (values[i] < 1 || values[i] > MAX_COPIES)
+                {
+                    fprintf(stderr, "Number of branches must be between 1 and %d: %d\n", MAX_COPIES, values[i]);
+                    return EXIT_FAILURE;
+                }
+                window = simulate_copies(values[i], (uint64_t)1 << stride_bits);
+                printf("Number of branches: %d, Ticks per branch: %f, Misses: %ld of %ld\n", values[i],
+                       (double)window / values[i], btb.misses, btb.hits + btb.misses);
+                sink_int(&sink, col[0], values[i]);
+                sink_int(&sink, col[2], 1);
+                sink_float(&sink, col[3], (double)window / values[i]);
+                sink_float(&sink, col[5], (double)window / values[i]);
+                break;
+            case LAYOUT_SIZE:
+                window = simulate_loop(dists[d], values[i], iterations);
+                printf("Distance: %d, Branches: %d, Ticks: %ld, Misses: %ld of %ld\n", dists[d], values[i], window,
+                       btb.misses, btb.hits + btb.misses);
+                sink_int(&sink, col[0], dists[d]);
+                sink_int(&sink, col[1], values[i]);
+                sink_int(&sink, col[3], window);
+                sink_float(&sink, col[4], window);
+                sink_float(&sink, col[5], (double)window / ((double)iterations * values[i]));
+                break;
+            }
+            sink_emit(&sink);
+        }
+    }
+
+    sink_close(&sink);
+    if (trace_path)
+    {
+        printf("Trace: %lu branches written to %s\n", (unsigned long)trace.records, trace_path);
+        trace_finish(&trace);
+    }
+    btb_free(&btb);
+    if (object)
+        elf_cache_close(&cache);
+    if (eb.code)
+        emit_free(&eb);
+    return 0;
+}
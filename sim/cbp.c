@@ -0,0 +1,300 @@
+#include <err.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cbp.h"
+
+#define WEIGHT_MAX 127 // Perceptron weights are 8 bits
+
+static const char *model_names[] = {"bimodal", "gshare", "TAGE", "perceptron"};
+
+static int history_bit(const struct cbp *p, int i)
+{
+    return p->ghr[(p->head + i) % CBP_MAX_HISTORY];
+}
+
+static void fold_init(struct cbp_fold *f, int length, int width)
+{
+    f->length = length;
+    f->width = width;
+    f->value = 0;
+}
+
+// The newest bit comes in at the bottom and the one that just left the length goes out where it was
+// folded in, so the value stays the xor of the history in width-bit pieces
+static void fold_push(struct cbp_fold *f, const struct cbp *p)
+{
+    f->value = (f->value << 1) | history_bit(p, 0);
+    f->value ^= (uint32_t)history_bit(p, f->length) << (f->length % f->width);
+    f->value ^= f->value >> f->width;
+    f->value &= (1U << f->width) - 1;
+}
+
+void cbp_init(struct cbp *p, const struct cbp_config *cfg)
+{
+    const char *name = model_names[cfg->model];
+    size_t entries = (size_t)1 << cfg->table_bits;
+
+    if (cfg->table_bits < 1 || cfg->table_bits > 24)
+        errx(EXIT_FAILURE, "%s: table bits must be between 1 and 24: %d", name, cfg->table_bits);
+    if (cfg->history < 0 || cfg->history >= CBP_MAX_HISTORY)
+        errx(EXIT_FAILURE, "%s: history must be between 0 and %d: %d", name, CBP_MAX_HISTORY - 1, cfg->history);
+    if (cfg->model == CBP_TAGE)
+    {
+        if (cfg->tables < 1 || cfg->tables > CBP_MAX_TABLES)
+            errx(EXIT_FAILURE, "TAGE: tables must be between 1 and %d: %d", CBP_MAX_TABLES, cfg->tables);
+        if (cfg->min_history < 1 || cfg->min_history > cfg->history)
+            errx(EXIT_FAILURE, "TAGE: shortest history must be between 1 and %d: %d", cfg->history,
+                 cfg->min_history);
+        if (cfg->tag_bits < 2 || cfg->tag_bits > 16)
+            errx(EXIT_FAILURE, "TAGE: tag bits must be between 2 and 16: %d", cfg->tag_bits);
+    }
+
+    memset(p, 0, sizeof(*p));
+    p->cfg = *cfg;
+
+    if (cfg->model == CBP_PERCEPTRON)
+    {
+        p->weights = malloc(entries * (cfg->history + 1) * sizeof(int16_t));
+        if (!p->weights)
+            err(EXIT_FAILURE, "Unable to allocate the perceptrons");
+        p->theta = (int)(1.93 * cfg->history + 14); // Jimenez and Lin's training threshold
+    }
+    else
+    {
+        p->counters = malloc(entries);
+        if (!p->counters)
+            err(EXIT_FAILURE, "Unable to allocate the %s counters", name);
+    }
+
+    // History lengths in a geometric series from min_history to history
+    if (cfg->model == CBP_TAGE)
+    {
+        for (int t = 0; t < cfg->tables; t++)
+        {
+            double x = cfg->tables == 1 ? 1 : (double)t / (cfg->tables - 1);
+
+            p->lengths[t] = (int)(cfg->min_history * pow((double)cfg->history / cfg->min_history, x) + 0.5);
+            p->tagged[t] = malloc(entries * sizeof(struct cbp_entry));
+            if (!p->tagged[t])
+                err(EXIT_FAILURE, "Unable to allocate the TAGE tables");
+        }
+    }
+    cbp_reset(p);
+}
+
+void cbp_reset(struct cbp *p)
+{
+    const struct cbp_config *cfg = &p->cfg;
+    size_t entries = (size_t)1 << cfg->table_bits;
+
+    memset(p->ghr, 0, sizeof(p->ghr));
+    p->head = 0;
+    if (p->counters)
+        memset(p->counters, 2, entries);
+    if (p->weights)
+        memset(p->weights, 0, entries * (cfg->history + 1) * sizeof(int16_t));
+    if (cfg->model == CBP_GSHARE)
+        fold_init(&p->index[0], cfg->history, cfg->table_bits);
+    if (cfg->model == CBP_TAGE)
+    {
+        for (int t = 0; t < cfg->tables; t++)
+        {
+            memset(p->tagged[t], 0, entries * sizeof(struct cbp_entry));
+            fold_init(&p->index[t], p->lengths[t], cfg->table_bits);
+            fold_init(&p->tag[0][t], p->lengths[t], cfg->tag_bits);
+            fold_init(&p->tag[1][t], p->lengths[t], cfg->tag_bits - 1);
+        }
+    }
+    p->conditionals = p->mispredicts = 0;
+}
+
+static void counter_update(int8_t *ctr, int taken, int min, int max)
+{
+    if (taken && *ctr < max)
+        (*ctr)++;
+    else if (!taken && *ctr > min)
+        (*ctr)--;
+}
+
+static int predict_counter(int8_t *ctr, int taken)
+{
+    int prediction = *ctr >= 2;
+
+    counter_update(ctr, taken, 0, 3);
+    return prediction;
+}
+
+static int predict_perceptron(struct cbp *p, uint64_t pc, int taken)
+{
+    int h = p->cfg.history;
+    int16_t *w = p->weights + ((pc >> 2) & ((1 << p->cfg.table_bits) - 1)) * (h + 1);
+    int y = w[0];
+
+    for (int i = 0; i < h; i++)
+        y += history_bit(p, i) ? w[i + 1] : -w[i + 1];
+
+    int prediction = y >= 0;
+    if (prediction != taken || abs(y) <= p->theta)
+    {
+        int t = taken ? 1 : -1;
+
+        for (int i = 0; i <= h; i++)
+        {
+            int x = i == 0 || history_bit(p, i - 1) ? t : -t;
+
+            if ((x > 0 && w[i] < WEIGHT_MAX) || (x < 0 && w[i] > -WEIGHT_MAX))
+                w[i] += x;
+        }
+    }
+    return prediction;
+}
+
+// Longest matching table provides the prediction, the next one the alternative; a newly allocated
+// entry that is still weak defers to the alternative
+static int predict_tage(struct cbp *p, uint64_t pc, int taken)
+{
+    const struct cbp_config *cfg = &p->cfg;
+    uint32_t mask = (1U << cfg->table_bits) - 1;
+    uint32_t index[CBP_MAX_TABLES];
+    uint16_t tag[CBP_MAX_TABLES];
+    int provider = -1, alt = -1;
+
+    for (int t = cfg->tables - 1; t >= 0; t--)
+    {
+        index[t] = ((pc >> 2) ^ (pc >> (2 + cfg->table_bits)) ^ p->index[t].value) & mask;
+        tag[t] = ((pc >> 2) ^ p->tag[0][t].value ^ (p->tag[1][t].value << 1)) & ((1U << cfg->tag_bits) - 1);
+        if (p->tagged[t][index[t]].tag != tag[t])
+            continue;
+        if (provider < 0)
+            provider = t;
+        else if (alt < 0)
+            alt = t;
+    }
+
+    int8_t *base = &p->counters[(pc >> 2) & mask];
+    int alt_prediction = alt >= 0 ? p->tagged[alt][index[alt]].ctr >= 0 : *base >= 2;
+    int prediction = alt_prediction;
+
+    if (provider >= 0)
+    {
+        struct cbp_entry *e = &p->tagged[provider][index[provider]];
+        int own = e->ctr >= 0;
+
+        if (e->useful > 0 || (e->ctr != 0 && e->ctr != -1))
+            prediction = own;
+        if (own != alt_prediction)
+        {
+            if (own == taken && e->useful < 3)
+                e->useful++;
+            else if (own != taken && e->useful > 0)
+                e->useful--;
+        }
+        counter_update(&e->ctr, taken, -4, 3);
+    }
+    else
+        counter_update(base, taken, 0, 3);
+
+    // A misprediction gets an entry in a longer table whose entry is not useful, or ages them all
+    if (prediction != taken && provider < cfg->tables - 1)
+    {
+        int allocated = 0;
+
+        for (int t = provider + 1; t < cfg->tables && !allocated; t++)
+        {
+            struct cbp_entry *e = &p->tagged[t][index[t]];
+
+            if (e->useful == 0)
+            {
+                e->tag = tag[t];
+                e->ctr = taken ? 0 : -1;
+                allocated = 1;
+            }
+        }
+        for (int t = provider + 1; t < cfg->tables && !allocated; t++)
+            if (p->tagged[t][index[t]].useful > 0)
+                p->tagged[t][index[t]].useful--;
+    }
+
+    if (p->conditionals % CBP_USEFUL_PERIOD == CBP_USEFUL_PERIOD - 1)
+        for (int t = 0; t < cfg->tables; t++)
+            for (uint32_t i = 0; i <= mask; i++)
+                p->tagged[t][i].useful >>= 1;
+    return prediction;
+}
+
+static void history_push(struct cbp *p, int bit)
+{
+    p->head = (p->head + CBP_MAX_HISTORY - 1) % CBP_MAX_HISTORY;
+    p->ghr[p->head] = bit;
+
+    if (p->cfg.model == CBP_GSHARE)
+        fold_push(&p->index[0], p);
+    if (p->cfg.model == CBP_TAGE)
+    {
+        for (int t = 0; t < p->cfg.tables; t++)
+        {
+            fold_push(&p->index[t], p);
+            fold_push(&p->tag[0][t], p);
+            fold_push(&p->tag[1][t], p);
+        }
+    }
+}
+
+int cbp_branch(struct cbp *p, uint64_t pc, uint64_t target, int conditional, int taken)
+{
+    int miss = 0;
+
+    if (conditional)
+    {
+        int prediction;
+        uint32_t mask = (1U << p->cfg.table_bits) - 1;
+
+        switch (p->cfg.model)
+        {
+        case CBP_BIMODAL:
+            prediction = predict_counter(&p->counters[(pc >> 2) & mask], taken);
+            break;
+        case CBP_GSHARE:
+            prediction = predict_counter(&p->counters[((pc >> 2) ^ p->index[0].value) & mask], taken);
+            break;
+        case CBP_TAGE:
+            prediction = predict_tage(p, pc, taken);
+            break;
+        default:
+            prediction = predict_perceptron(p, pc, taken);
+            break;
+        }
+        miss = prediction != taken;
+        p->conditionals++;
+        p->mispredicts += miss;
+    }
+
+    switch (p->cfg.update)
+    {
+    case CBP_UPDATE_COND:
+        if (conditional)
+            history_push(p, taken);
+        break;
+    case CBP_UPDATE_ALL:
+        history_push(p, conditional ? taken : 1);
+        break;
+    case CBP_UPDATE_PATH:
+        if (taken)
+            history_push(p, __builtin_parityll((pc >> 2) ^ (target >> 3)));
+        break;
+    }
+    return miss;
+}
+
+void cbp_free(struct cbp *p)
+{
+    free(p->counters);
+    free(p->weights);
+    for (int t = 0; t < CBP_MAX_TABLES; t++)
+        free(p->tagged[t]);
+    p->counters = NULL;
+    p->weights = NULL;
+    memset(p->tagged, 0, sizeof(p->tagged));
+}
@@ -0,0 +1,78 @@
+#ifndef CBP_H
+#define CBP_H
+
+#include <stdint.h>
+
+#define CBP_MAX_HISTORY 2048 // Global history bits kept, enough for the longest TAGE table
+#define CBP_MAX_TABLES 16    // Tagged TAGE tables
+#define CBP_USEFUL_PERIOD (1L << 18) // Conditional branches between two agings of the TAGE useful bits
+
+enum cbp_model
+{
+    CBP_BIMODAL,    // 2-bit counters indexed by the address alone
+    CBP_GSHARE,     // 2-bit counters indexed by the address xor the last `history` bits
+    CBP_TAGE,       // Bimodal base and `tables` tagged tables with geometric history lengths
+    CBP_PERCEPTRON, // One weight per history bit, rows indexed by the address
+};
+
+// What goes into the global history
+enum cbp_update
+{
+    CBP_UPDATE_COND, // The direction of every conditional branch
+    CBP_UPDATE_ALL,  // The direction of every branch, unconditional ones counting as taken
+    CBP_UPDATE_PATH, // A bit hashed from the addresses of every taken branch; not-taken ones leave no trace
+};
+
+struct cbp_config
+{
+    enum cbp_model model;
+    int table_bits;  // log2 of the entries of each table, or of the perceptron rows
+    int history;     // History bits used, the longest table's for TAGE
+    int min_history; // TAGE: the shortest table's
+    int tables;      // TAGE: tagged tables
+    int tag_bits;    // TAGE
+    enum cbp_update update;
+};
+
+// History of `length` bits folded into `width` by xor, kept up to date one shift at a time
+struct cbp_fold
+{
+    int length, width;
+    uint32_t value;
+};
+
+struct cbp_entry
+{
+    int8_t ctr; // -4..3, taken when >= 0
+    uint8_t useful;
+    uint16_t tag;
+};
+
+// Conditional-branch direction predictor. Every branch goes through cbp_branch: conditional ones are
+// predicted and trained, and all of them update the history as the configuration says.
+struct cbp
+{
+    struct cbp_config cfg;
+    uint8_t ghr[CBP_MAX_HISTORY]; // Bit i back is ghr[(head + i) % CBP_MAX_HISTORY]
+    int head;
+    int8_t *counters;             // Bimodal, gshare and the TAGE base: 0..3, taken when >= 2
+    struct cbp_entry *tagged[CBP_MAX_TABLES];
+    int lengths[CBP_MAX_TABLES];
+    struct cbp_fold index[CBP_MAX_TABLES], tag[2][CBP_MAX_TABLES];
+    int16_t *weights; // Perceptron: rows x (history + 1), bias first
+    int theta;
+    long conditionals, mispredicts;
+};
+
+// Exits on an invalid configuration
+void cbp_init(struct cbp *p, const struct cbp_config *cfg);
+
+// Forget all training and history and clear the counts
+void cbp_reset(struct cbp *p);
+
+// One executed branch; returns 1 if it was conditional and mispredicted
+int cbp_branch(struct cbp *p, uint64_t pc, uint64_t target, int conditional, int taken);
+
+void cbp_free(struct cbp *p);
+
+#endif
@@ -0,0 +1,308 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "a64.h"
+#include "bpure.h"
+#include "cbp.h"
+#include "elfcache.h"
+#include "emit.h"
+#include "sink.h"
+#include "trials.h"
+#include "trace.h"
+
+#define MAX_RANGE_LEN 256
+#define DEFAULT_DUMMIES "0..49"
+#define DEFAULT_TRIALS 10000
+#define DEFAULT_WARMUP 2000 // Unmeasured trials after each reset of the model
+
+#define TARGET_ADDRESS 0x10000000 // Where ghr_len loads perform_branch
+
+// Stand-ins for ghr_len's own code, whose layout is the compiler's: run_pmu calls perform_branch for the
+// train and the test branch directly, the counter reads around them being branch-free, and calls
+// dummy_branch from a for loop in between. Besides the dummies that leaves perform_branch's ret, the jump
+// to the loop condition, the loop's exit and the blr of the test branch, as ghr_len's FIXED_BRANCHES.
+#define HARNESS_ADDRESS 0x400000
+#define TRAIN_CALL (HARNESS_ADDRESS + 0x100)    // blr perform_branch
+#define LOOP_START (HARNESS_ADDRESS + 0x110)    // b to the loop condition
+#define DUMMY_CALL (HARNESS_ADDRESS + 0x118)    // bl dummy_branch
+#define LOOP_BRANCH (HARNESS_ADDRESS + 0x128)   // b.lt back to DUMMY_CALL
+#define TEST_CALL (HARNESS_ADDRESS + 0x140)     // blr perform_branch
+#define DUMMY_ADDRESS (HARNESS_ADDRESS + 0x300) // dummy_branch
+#define FIXED_BRANCHES 4
+#define FIXED_CONDITIONAL_BRANCHES 1
+
+struct cbp cbp;
+struct sink sink;
+struct emit_buf eb;
+const uint32_t *perform, *dummy; // perform_branch and dummy_branch
+size_t perform_len, dummy_len;
+int with_harness = 1; // Feed the calls, returns and loop branch of ghr_len to the model as well
+struct trace_writer trace;
+const char *trace_path = NULL; // Every branch the model sees is also written here
+
+void branch(uint64_t pc, uint64_t target, enum trace_kind kind, int taken, void *ctx)
+{
+    if (trace_path)
+        trace_write(&trace, pc, target, kind, taken);
+    cbp_branch(&cbp, pc, target, kind == TRACE_COND, taken);
+}
+
+void harness(uint64_t pc, uint64_t target, enum trace_kind kind, int taken)
+{
+    if (with_harness)
+        branch(pc, target, kind, taken, NULL);
+}
+
+// Call a function of the experiment from site; returns the mispredicts of its own branches
+long call(const uint32_t *code, size_t len, uint64_t base, uint64_t site, uint64_t arg)
+{
+    harness(site, base, TRACE_CALL, 1);
+    long before = cbp.mispredicts;
+    uint64_t ret = a64_run(code, len, base, arg, branch, NULL);
+    long misses = cbp.mispredicts - before;
+    harness(ret, site + 4, TRACE_RET, 1);
+    return misses;
+}
+
+// One trial of run_pmu: train branch, dummies calls of dummy_branch, test branch
+void trial(int dummies, long *train, long *test)
+{
+    int cond = (int)xrand() % 2;
+
+    *train = call(perform, perform_len, TARGET_ADDRESS, TRAIN_CALL, cond);
+    harness(LOOP_START, LOOP_BRANCH, TRACE_JUMP, 1);
+    for (int j = 0; j < dummies; j++)
+    {
+        harness(LOOP_BRANCH, DUMMY_CALL, TRACE_COND, 1);
+        call(dummy, dummy_len, DUMMY_ADDRESS, DUMMY_CALL, 0);
+    }
+    harness(LOOP_BRANCH, DUMMY_CALL, TRACE_COND, 0);
+    *test = call(perform, perform_len, TARGET_ADDRESS, TEST_CALL, cond);
+}
+
+// perform_branch from ghr_len's branch.o, or the same instructions emitted here:
+// cmp w0, #0; b.eq 1f; nop; add sp, sp, #0x10; ret; 1: ret. dummy_branch is always emitted: b 1f; nop; 1: ret
+void load_functions(const char *object, struct elf_cache *cache)
+{
+    emit_init(&eb, NULL, 4096);
+    uint32_t *b = emit_b(&eb, NULL);
+    emit_nop(&eb);
+    emit_patch(b, emit_here(&eb));
+    emit_ret(&eb);
+    dummy = eb.code;
+    dummy_len = eb.len;
+
+    if (object)
+    {
+        elf_cache_open(cache, object);
+        const struct elf_span *span = elf_cache_get(cache, "perform_branch");
+        perform = span->code;
+        perform_len = span->size / 4;
+        return;
+    }
+
+    perform = emit_here(&eb);
+    emit_cmp(&eb, 0, 0, 0);
+    uint32_t *beq = emit_bcond(&eb, A64_EQ, NULL);
+    emit_nop(&eb);
+    emit_insn(&eb, 0x910043ff); // add sp, sp, #0x10
+    emit_ret(&eb);
+    emit_patch(beq, emit_here(&eb));
+    emit_ret(&eb);
+    perform_len = emit_here(&eb) - perform;
+}
+
+void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [-m bimodal|gshare|tage|perceptron] [-T table_bits] [-h history] [-l min_history] "
+            "[-N tables] [-G tag_bits]\n"
+            "       [-g cond|all|path] [-H all|none] [-d dummies] [-n trials] [-w warmup] [-e branch.o] "
+            "[-r seed] [-t trace] [-o results [-f csv|jsonl|bin]]\n",
+            prog);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv)
+{
+    struct cbp_config cfg = {CBP_GSHARE, 12, 12, 4, 6, 9, CBP_UPDATE_COND};
+    struct elf_cache cache;
+    int dummy_counts[MAX_RANGE_LEN];
+    int num_dummies = parse_range(DEFAULT_DUMMIES, dummy_counts, MAX_RANGE_LEN);
+    long trials = DEFAULT_TRIALS, warmup = DEFAULT_WARMUP;
+    uint64_t seed = 1;
+    const char *object = NULL, *results_path = NULL, *results_format = NULL;
+    const char *model = "gshare", *update = "cond", *harness_mode = "all";
+    int opt;
+
+    while ((opt = getopt(argc, argv, "m:T:h:l:N:G:g:H:d:n:w:e:r:t:o:f:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'm':
+            model = optarg;
+            break;
+        case 'T':
+            cfg.table_bits = atoi(optarg);
+            break;
+        case 'h':
+            cfg.history = atoi(optarg);
+            break;
+        case 'l':
+            cfg.min_history = atoi(optarg);
+            break;
+        case 'N':
+            cfg.tables = atoi(optarg);
+            break;
+        case 'G':
+            cfg.tag_bits = atoi(optarg);
+            break;
+        case 'g':
+            update = optarg;
+            break;
+        case 'H':
+            harness_mode = optarg;
+            break;
+        case 'd':
+            num_dummies = parse_range(optarg, dummy_counts, MAX_RANGE_LEN);
+            break;
+        case 'n':
+            trials = atol(optarg);
+            break;
+        case 'w':
+            warmup = atol(optarg);
+            break;
+        case 'e':
+            object = optarg;
+            break;
+        case 'r':
+            seed = strtoull(optarg, NULL, 0);
+            break;
+        case 't':
+            trace_path = optarg;
+            break;
+        case 'o':
+            results_path = optarg;
+            break;
+        case 'f':
+            results_format = optarg;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+
+    if (strcmp(model, "bimodal") == 0)
+        cfg.model = CBP_BIMODAL;
+    else if (strcmp(model, "gshare") == 0)
+        cfg.model = CBP_GSHARE;
+    else if (strcmp(model, "tage") == 0)
+        cfg.model = CBP_TAGE;
+    else if (strcmp(model, "perceptron") == 0)
+        cfg.model = CBP_PERCEPTRON;
+    else
+        usage(argv[0]);
+    if (strcmp(update, "cond") == 0)
+        cfg.update = CBP_UPDATE_COND;
+    else if (strcmp(update, "all") == 0)
+        cfg.update = CBP_UPDATE_ALL;
+    else if (strcmp(update, "path") == 0)
+        cfg.update = CBP_UPDATE_PATH;
+    else
+        usage(argv[0]);
+    if (strcmp(harness_mode, "all") != 0 && strcmp(harness_mode, "none") != 0)
+        usage(argv[0]);
+    with_harness = strcmp(harness_mode, "all") == 0;
+    if (trials < 1 || warmup < 0)
+        usage(argv[0]);
+
+    cbp_init(&cbp, &cfg);
+    if (trace_path)
+        trace_create(&trace, trace_path);
+    load_functions(object, &cache);
+    xsrand(seed);
+
+    // Same columns and experiment name as ghr_len -m pmu, so both go through bpure analyze alike
+    int col_dummies, col_trials, col_train, col_test, col_test_ci, col_test_median;
+    sink_open(&sink, results_path, results_format);
+    col_dummies = sink_column(&sink, "dummies", SINK_INT);
+    col_trials = sink_column(&sink, "trials", SINK_INT);
+    col_train = sink_column(&sink, "train", SINK_FLOAT);
+    col_test = sink_column(&sink, "test", SINK_FLOAT);
+    col_test_ci = sink_column(&sink, "test_ci", SINK_FLOAT);
+    col_test_median = sink_column(&sink, "test_median", SINK_FLOAT);
+    sink_meta_system(&sink, 0, argc, argv);
+    sink_meta(&sink, "experiment", "ghr_len");
+    sink_meta(&sink, "mode", "pmu");
+    sink_meta(&sink, "simulator", "model=%s table_bits=%d history=%d min_history=%d tables=%d tag_bits=%d update=%s",
+              model, cfg.table_bits, cfg.history, cfg.min_history, cfg.tables, cfg.tag_bits, update);
+    sink_meta(&sink, "harness", "%s", harness_mode);
+    if (with_harness)
+    {
+        sink_meta(&sink, "fixed_branches", "%d", FIXED_BRANCHES);
+        sink_meta(&sink, "fixed_conditional_branches", "%d", FIXED_CONDITIONAL_BRANCHES);
+    }
+    sink_meta(&sink, "function", "%s", object ? object : "built-in");
+    sink_meta(&sink, "seed", "%lu", (unsigned long)seed);
+    sink_start(&sink);
+
+    printf("Predictor model: %s, 2^%d entries, %d history bits (%s history), ghr_len harness branches: %s\n", model,
+           cfg.table_bits, cfg.history, update, harness_mode);
+    if (cfg.model == CBP_TAGE)
+    {
+        printf("TAGE history lengths:");
+        for (int t = 0; t < cfg.tables; t++)
+            printf(" %d", cbp.lengths[t]);
+        printf(", %d tag bits\n", cfg.tag_bits);
+    }
+
+    for (int i = 0; i < num_dummies; i++)
+    {
+        int dummies = dummy_counts[i];
+        long train = 0;
+        struct welford test;
+
+        welford_init(&test);
+        cbp_reset(&cbp);
+        for (long r = 0; r < warmup; r++)
+        {
+            long a, b;
+            trial(dummies, &a, &b);
+        }
+        for (long r = 0; r < trials; r++)
+        {
+            long a, b;
+            trial(dummies, &a, &b);
+            train += a;
+            welford_add(&test, b);
+        }
+
+        printf("Number of dummy branches: %d\n", dummies);
+        printf("Average mispredicts for train branch: %f\n", (double)train / trials);
+        printf("Average mispredicts for test branch: %f (%ld trials)\n", test.mean, trials);
+
+        sink_int(&sink, col_dummies, dummies);
+        sink_int(&sink, col_trials, trials);
+        sink_float(&sink, col_train, (double)train / trials);
+        sink_float(&sink, col_test, test.mean);
+        sink_float(&sink, col_test_ci, welford_ci(&test));
+        sink_float(&sink, col_test_median, NAN);
+        sink_emit(&sink);
+    }
+
+    sink_close(&sink);
+    if (trace_path)
+    {
+        printf("Trace: %lu branches written to %s\n", (unsigned long)trace.records, trace_path);
+        trace_finish(&trace);
+    }
+    cbp_free(&cbp);
+    if (object)
+        elf_cache_close(&cache);
+    emit_free(&eb);
+    return 0;
+}
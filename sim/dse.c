@@ -0,0 +1,436 @@
+#include <err.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bpure.h"
+#include "btb.h"
+#include "cbp.h"
+#include "sink.h"
+#include "steal.h"
+#include "trace.h"
+#include "workers.h"
+
+#define MAX_RANGE_LEN 256
+#define MAX_TRACES 64
+#define DEFAULT_CHUNK 16 // Blocks of a trace in one work item
+#define DEFAULT_WARMUP 1 // Blocks before a chunk run through the model uncounted
+
+enum family
+{
+    FAMILY_BTB,
+    FAMILY_CBP,
+};
+
+struct config
+{
+    enum family family;
+    struct btb_config btb;
+    struct cbp_config cbp;
+};
+
+// A run of blocks of one trace
+struct chunk
+{
+    int trace;
+    uint32_t first, end;
+};
+
+// Totals of one configuration on one trace, added to by every worker
+struct stats
+{
+    _Atomic uint64_t lookups; // Taken branches for a BTB, conditional ones for a predictor
+    _Atomic uint64_t misses;
+};
+
+struct trace traces[MAX_TRACES];
+int num_traces;
+struct config *configs;
+int num_configs;
+struct chunk *chunks;
+int num_chunks;
+int warmup = DEFAULT_WARMUP;
+struct stats *stats;              // num_configs x num_traces, shared with the workers
+_Atomic uint64_t *simulated;      // Branches through a model, warm-up included
+struct sink sink;
+
+double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Blocks [first, end) of a trace through the model of cfg; counts only if counted is set
+uint64_t simulate(const struct config *cfg, struct btb *btb, struct cbp *cbp, const struct trace *t, uint32_t first,
+                  uint32_t end, int counted, uint64_t *lookups, uint64_t *misses)
+{
+    struct trace_cursor c;
+    struct trace_record r;
+    uint64_t n = 0;
+
+    trace_seek(t, &c, first, end);
+    while (trace_next(&c, &r))
+    {
+        n++;
+        if (cfg->family == FAMILY_BTB)
+        {
+            if (!r.taken)
+                continue;
+            int hit = btb_access(btb, r.pc, r.target);
+            *lookups += counted;
+            *misses += counted && !hit;
+        }
+        else
+        {
+            int miss = cbp_branch(cbp, r.pc, r.target, r.kind == TRACE_COND, r.taken);
+            *lookups += counted && r.kind == TRACE_COND;
+            *misses += counted && miss;
+        }
+    }
+    return n;
+}
+
+// One configuration on one chunk, from a cold model warmed up on the blocks before the chunk
+void run_item(long item, int worker, void *ctx)
+{
+    const struct config *cfg = &configs[item / num_chunks];
+    const struct chunk *ch = &chunks[item % num_chunks];
+    const struct trace *t = &traces[ch->trace];
+    uint32_t warm = ch->first > (uint32_t)warmup ? ch->first - warmup : 0;
+    uint64_t lookups = 0, misses = 0, n;
+    struct btb btb;
+    struct cbp cbp;
+
+    if (cfg->family == FAMILY_BTB)
+        btb_init(&btb, &cfg->btb);
+    else
+        cbp_init(&cbp, &cfg->cbp);
+
+    n = simulate(cfg, &btb, &cbp, t, warm, ch->first, 0, &lookups, &misses);
+    n += simulate(cfg, &btb, &cbp, t, ch->first, ch->end, 1, &lookups, &misses);
+
+    struct stats *st = &stats[(item / num_chunks) * num_traces + ch->trace];
+    atomic_fetch_add_explicit(&st->lookups, lookups, memory_order_relaxed);
+    atomic_fetch_add_explicit(&st->misses, misses, memory_order_relaxed);
+    atomic_fetch_add_explicit(simulated, n, memory_order_relaxed);
+
+    if (cfg->family == FAMILY_BTB)
+        btb_free(&btb);
+    else
+        cbp_free(&cbp);
+}
+
+void add_config(const struct config *cfg)
+{
+    configs = realloc(configs, (num_configs + 1) * sizeof(struct config));
+    if (!configs)
+        err(EXIT_FAILURE, "Unable to allocate the configurations");
+    configs[num_configs++] = *cfg;
+}
+
+void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s -i trace[,trace...] [-x btb|cbp|both] [-S sets] [-W ways] [-H bits,xor] [-I index_shift] "
+            "[-T tag_bits] [-p lru|fifo|random]\n"
+            "       [-m bimodal|gshare|tage|perceptron] [-B table_bits] [-h history] [-l min_history] [-N tables] "
+            "[-G tag_bits] [-g cond|all|path]\n"
+            "       [-j cpus] [-k] [-C chunk_blocks] [-w warmup_blocks] [-o results [-f csv|jsonl|bin]]\n",
+            prog);
+    fprintf(stderr, "  -S, -W, -B and -h are ranges; every combination is simulated on every trace\n");
+    fprintf(stderr, "  -C 0 runs each trace whole, exactly as replay does\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv)
+{
+    int sets[MAX_RANGE_LEN], ways[MAX_RANGE_LEN], table_bits[MAX_RANGE_LEN], history[MAX_RANGE_LEN];
+    int num_sets = parse_range("16..1024*2", sets, MAX_RANGE_LEN);
+    int num_ways = parse_range("1,2,4,8", ways, MAX_RANGE_LEN);
+    int num_table_bits = parse_range("10..14:2", table_bits, MAX_RANGE_LEN);
+    int num_history = parse_range("0..32:4", history, MAX_RANGE_LEN);
+    struct btb_config btb_base = {64, 4, 2, 0, BTB_HASH_BITS, BTB_LRU, 1};
+    struct cbp_config cbp_base = {CBP_GSHARE, 12, 12, 4, 6, 9, CBP_UPDATE_COND};
+    const char *paths = NULL, *family = "both", *hashes = "bits,xor", *policy = "lru", *model = "gshare";
+    const char *update = "cond", *cpus = "all", *results_path = NULL, *results_format = NULL;
+    int chunk_blocks = DEFAULT_CHUNK, reserve = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:x:S:W:H:I:T:p:m:B:h:l:N:G:g:j:kC:w:o:f:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'i':
+            paths = optarg;
+            break;
+        case 'x':
+            family = optarg;
+            break;
+        case 'S':
+            num_sets = parse_range(optarg, sets, MAX_RANGE_LEN);
+            break;
+        case 'W':
+            num_ways = parse_range(optarg, ways, MAX_RANGE_LEN);
+            break;
+        case 'H':
+            hashes = optarg;
+            break;
+        case 'I':
+            btb_base.index_shift = atoi(optarg);
+            break;
+        case 'T':
+            btb_base.tag_bits = atoi(optarg);
+            break;
+        case 'p':
+            policy = optarg;
+            break;
+        case 'm':
+            model = optarg;
+            break;
+        case 'B':
+            num_table_bits = parse_range(optarg, table_bits, MAX_RANGE_LEN);
+            break;
+        case 'h':
+            num_history = parse_range(optarg, history, MAX_RANGE_LEN);
+            break;
+        case 'l':
+            cbp_base.min_history = atoi(optarg);
+            break;
+        case 'N':
+            cbp_base.tables = atoi(optarg);
+            break;
+        case 'G':
+            cbp_base.tag_bits = atoi(optarg);
+            break;
+        case 'g':
+            update = optarg;
+            break;
+        case 'j':
+            cpus = optarg;
+            break;
+        case 'k':
+            reserve = 1;
+            break;
+        case 'C':
+            chunk_blocks = atoi(optarg);
+            break;
+        case 'w':
+            warmup = atoi(optarg);
+            break;
+        case 'o':
+            results_path = optarg;
+            break;
+        case 'f':
+            results_format = optarg;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+
+    int with_btb = strcmp(family, "btb") == 0 || strcmp(family, "both") == 0;
+    int with_cbp = strcmp(family, "cbp") == 0 || strcmp(family, "both") == 0;
+    if (!paths || (!with_btb && !with_cbp) || chunk_blocks < 0 || warmup < 0)
+        usage(argv[0]);
+    if (strcmp(policy, "lru") == 0)
+        btb_base.policy = BTB_LRU;
+    else if (strcmp(policy, "fifo") == 0)
+        btb_base.policy = BTB_FIFO;
+    else if (strcmp(policy, "random") == 0)
+        btb_base.policy = BTB_RANDOM;
+    else
+        usage(argv[0]);
+    if (strcmp(model, "bimodal") == 0)
+        cbp_base.model = CBP_BIMODAL;
+    else if (strcmp(model, "gshare") == 0)
+        cbp_base.model = CBP_GSHARE;
+    else if (strcmp(model, "tage") == 0)
+        cbp_base.model = CBP_TAGE;
+    else if (strcmp(model, "perceptron") == 0)
+        cbp_base.model = CBP_PERCEPTRON;
+    else
+        usage(argv[0]);
+    if (strcmp(update, "cond") == 0)
+        cbp_base.update = CBP_UPDATE_COND;
+    else if (strcmp(update, "all") == 0)
+        cbp_base.update = CBP_UPDATE_ALL;
+    else if (strcmp(update, "path") == 0)
+        cbp_base.update = CBP_UPDATE_PATH;
+    else
+        usage(argv[0]);
+
+    // Traces are mapped before the workers fork and shared by all of them
+    char *copy = strdup(paths);
+    for (char *tok = strtok(copy, ","); tok; tok = strtok(NULL, ","))
+    {
+        if (num_traces == MAX_TRACES)
+            errx(EXIT_FAILURE, "More than %d traces", MAX_TRACES);
+        trace_open(&traces[num_traces], tok);
+        printf("Trace %d: %s, %lu records in %u blocks\n", num_traces, tok,
+               (unsigned long)traces[num_traces].header->records, traces[num_traces].header->blocks);
+        num_traces++;
+    }
+    for (int t = 0; t < num_traces; t++)
+    {
+        uint32_t blocks = traces[t].header->blocks;
+        uint32_t step = chunk_blocks ? chunk_blocks : (blocks ? blocks : 1);
+
+        for (uint32_t first = 0; first < blocks; first += step)
+        {
+            chunks = realloc(chunks, (num_chunks + 1) * sizeof(struct chunk));
+            if (!chunks)
+                err(EXIT_FAILURE, "Unable to allocate the chunks");
+            chunks[num_chunks].trace = t;
+            chunks[num_chunks].first = first;
+            chunks[num_chunks].end = first + step < blocks ? first + step : blocks;
+            num_chunks++;
+        }
+    }
+    if (chunk_blocks == 0)
+        warmup = 0;
+
+    // The design space: every BTB geometry and hash, every predictor size and history
+    struct config cfg;
+    for (int a = 0; with_btb && a < num_sets; a++)
+        for (int b = 0; b < num_ways; b++)
+        {
+            char *hcopy = strdup(hashes);
+            for (char *tok = strtok(hcopy, ","); tok; tok = strtok(NULL, ","))
+            {
+                memset(&cfg, 0, sizeof(cfg));
+                cfg.family = FAMILY_BTB;
+                cfg.btb = btb_base;
+                cfg.btb.sets = sets[a];
+                cfg.btb.ways = ways[b];
+                if (strcmp(tok, "bits") == 0)
+                    cfg.btb.hash = BTB_HASH_BITS;
+                else if (strcmp(tok, "xor") == 0)
+                    cfg.btb.hash = BTB_HASH_XOR;
+                else
+                    usage(argv[0]);
+                add_config(&cfg);
+            }
+            free(hcopy);
+        }
+    for (int a = 0; with_cbp && a < num_table_bits; a++)
+        for (int b = 0; b < num_history; b++)
+        {
+            memset(&cfg, 0, sizeof(cfg));
+            cfg.family = FAMILY_CBP;
+            cfg.cbp = cbp_base;
+            cfg.cbp.table_bits = table_bits[a];
+            cfg.cbp.history = history[b];
+            if (cfg.cbp.model == CBP_TAGE && cfg.cbp.min_history > cfg.cbp.history)
+                continue;
+            add_config(&cfg);
+        }
+
+    // Invalid configurations fail here rather than in a worker
+    for (int i = 0; i < num_configs; i++)
+    {
+        struct btb btb;
+        struct cbp cbp;
+
+        if (configs[i].family == FAMILY_BTB)
+        {
+            btb_init(&btb, &configs[i].btb);
+            btb_free(&btb);
+        }
+        else
+        {
+            cbp_init(&cbp, &configs[i].cbp);
+            cbp_free(&cbp);
+        }
+    }
+
+    size_t shared_size = ((size_t)num_configs * num_traces * sizeof(struct stats)) + sizeof(*simulated);
+    stats = mmap(NULL, shared_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (stats == MAP_FAILED)
+        err(EXIT_FAILURE, "Unable to map the statistics");
+    simulated = (_Atomic uint64_t *)(stats + (size_t)num_configs * num_traces);
+
+    struct sweep sweep;
+    sweep_parse(&sweep, cpus, reserve, 0);
+    long num_items = (long)num_configs * num_chunks;
+    printf("%d configurations x %d chunks of %d traces = %ld work items on %d workers\n", num_configs, num_chunks,
+           num_traces, num_items, sweep.num_workers);
+
+    double start = now();
+    long steals = steal_run(&sweep, num_items, NULL, run_item, NULL);
+    double seconds = now() - start;
+
+    sink_open(&sink, results_path, results_format);
+    int col_trace = sink_column(&sink, "trace", SINK_INT);
+    int col_sets = sink_column(&sink, "sets", SINK_INT);
+    int col_ways = sink_column(&sink, "ways", SINK_INT);
+    int col_xor = sink_column(&sink, "xor_hash", SINK_INT);
+    int col_table_bits = sink_column(&sink, "table_bits", SINK_INT);
+    int col_history = sink_column(&sink, "history", SINK_INT);
+    int col_lookups = sink_column(&sink, "lookups", SINK_INT);
+    int col_misses = sink_column(&sink, "misses", SINK_INT);
+    int col_rate = sink_column(&sink, "miss_rate", SINK_FLOAT);
+    sink_meta_system(&sink, 0, argc, argv);
+    sink_meta(&sink, "experiment", "dse");
+    sink_meta(&sink, "traces", "%s", paths);
+    sink_meta(&sink, "btb", "index_shift=%d tag_bits=%d policy=%s", btb_base.index_shift, btb_base.tag_bits, policy);
+    sink_meta(&sink, "predictor", "model=%s min_history=%d tables=%d tag_bits=%d update=%s", model,
+              cbp_base.min_history, cbp_base.tables, cbp_base.tag_bits, update);
+    sink_meta(&sink, "chunk_blocks", "%d", chunk_blocks);
+    sink_meta(&sink, "warmup_blocks", "%d", warmup);
+    sink_meta(&sink, "workers", "%d", sweep.num_workers);
+    sink_start(&sink);
+
+    // Rows in configuration order, whichever worker ran what
+    for (int i = 0; i < num_configs; i++)
+    {
+        const struct config *c = &configs[i];
+
+        for (int t = 0; t < num_traces; t++)
+        {
+            const struct stats *st = &stats[(size_t)i * num_traces + t];
+            uint64_t lookups = atomic_load(&st->lookups), misses = atomic_load(&st->misses);
+            double rate = lookups ? (double)misses / lookups : 0;
+
+            if (c->family == FAMILY_BTB)
+                printf("Trace %d, BTB %d sets x %d ways (%s): %lu misses of %lu taken branches (%.2f%%)\n", t,
+                       c->btb.sets, c->btb.ways, c->btb.hash == BTB_HASH_XOR ? "xor" : "bits",
+                       (unsigned long)misses, (unsigned long)lookups, 100 * rate);
+            else
+                printf("Trace %d, %s 2^%d entries, %d history bits: %lu mispredicts of %lu conditional branches "
+                       "(%.2f%%)\n",
+                       t, model, c->cbp.table_bits, c->cbp.history, (unsigned long)misses, (unsigned long)lookups,
+                       100 * rate);
+
+            sink_int(&sink, col_trace, t);
+            sink_int(&sink, col_sets, c->family == FAMILY_BTB ? c->btb.sets : -1);
+            sink_int(&sink, col_ways, c->family == FAMILY_BTB ? c->btb.ways : -1);
+            sink_int(&sink, col_xor, c->family == FAMILY_BTB ? c->btb.hash == BTB_HASH_XOR : -1);
+            sink_int(&sink, col_table_bits, c->family == FAMILY_CBP ? c->cbp.table_bits : -1);
+            sink_int(&sink, col_history, c->family == FAMILY_CBP ? c->cbp.history : -1);
+            sink_int(&sink, col_lookups, lookups);
+            sink_int(&sink, col_misses, misses);
+            sink_float(&sink, col_rate, rate);
+            sink_emit(&sink);
+        }
+    }
+
+    uint64_t branches = atomic_load(simulated);
+    printf("Simulated %lu branches in %.3f s on %d workers: %.1f M branches/s, %ld steals\n",
+           (unsigned long)branches, seconds, sweep.num_workers, seconds > 0 ? branches / seconds / 1e6 : 0.0, steals);
+
+    sink_close(&sink);
+    munmap(stats, shared_size);
+    for (int t = 0; t < num_traces; t++)
+        trace_close(&traces[t]);
+    free(copy);
+    free(configs);
+    free(chunks);
+    return 0;
+}
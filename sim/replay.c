@@ -0,0 +1,230 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "btb.h"
+#include "cbp.h"
+#include "sink.h"
+#include "trace.h"
+
+static const char *kind_names[] = {"cond", "jump", "call", "ret", "indirect"};
+
+void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s -i trace [-S sets] [-W ways] [-I index_shift] [-T tag_bits] [-H bits|xor] "
+            "[-p lru|fifo|random] [-r seed]\n"
+            "       [-m bimodal|gshare|tage|perceptron] [-B table_bits] [-h history] [-l min_history] [-N tables] "
+            "[-G tag_bits] [-g cond|all|path]\n"
+            "       [-n max_records] [-d] [-o results [-f csv|jsonl|bin]]\n",
+            prog);
+    fprintf(stderr, "  -d prints the records instead of replaying them\n");
+    exit(EXIT_FAILURE);
+}
+
+double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+    struct btb_config btb_cfg = {64, 4, 2, 0, BTB_HASH_BITS, BTB_LRU, 1};
+    struct cbp_config cbp_cfg = {CBP_GSHARE, 12, 12, 4, 6, 9, CBP_UPDATE_COND};
+    const char *hash = "bits", *policy = "lru", *model = "gshare", *update = "cond";
+    const char *path = NULL, *results_path = NULL, *results_format = NULL;
+    uint64_t max_records = 0;
+    int dump = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:S:W:I:T:H:p:r:m:B:h:l:N:G:g:n:do:f:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'i':
+            path = optarg;
+            break;
+        case 'S':
+            btb_cfg.sets = atoi(optarg);
+            break;
+        case 'W':
+            btb_cfg.ways = atoi(optarg);
+            break;
+        case 'I':
+            btb_cfg.index_shift = atoi(optarg);
+            break;
+        case 'T':
+            btb_cfg.tag_bits = atoi(optarg);
+            break;
+        case 'H':
+            hash = optarg;
+            break;
+        case 'p':
+            policy = optarg;
+            break;
+        case 'r':
+            btb_cfg.seed = strtoull(optarg, NULL, 0);
+            break;
+        case 'm':
+            model = optarg;
+            break;
+        case 'B':
+            cbp_cfg.table_bits = atoi(optarg);
+            break;
+        case 'h':
+            cbp_cfg.history = atoi(optarg);
+            break;
+        case 'l':
+            cbp_cfg.min_history = atoi(optarg);
+            break;
+        case 'N':
+            cbp_cfg.tables = atoi(optarg);
+            break;
+        case 'G':
+            cbp_cfg.tag_bits = atoi(optarg);
+            break;
+        case 'g':
+            update = optarg;
+            break;
+        case 'n':
+            max_records = strtoull(optarg, NULL, 0);
+            break;
+        case 'd':
+            dump = 1;
+            break;
+        case 'o':
+            results_path = optarg;
+            break;
+        case 'f':
+            results_format = optarg;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+
+    if (!path)
+        usage(argv[0]);
+    if (strcmp(hash, "bits") == 0)
+        btb_cfg.hash = BTB_HASH_BITS;
+    else if (strcmp(hash, "xor") == 0)
+        btb_cfg.hash = BTB_HASH_XOR;
+    else
+        usage(argv[0]);
+    if (strcmp(policy, "lru") == 0)
+        btb_cfg.policy = BTB_LRU;
+    else if (strcmp(policy, "fifo") == 0)
+        btb_cfg.policy = BTB_FIFO;
+    else if (strcmp(policy, "random") == 0)
+        btb_cfg.policy = BTB_RANDOM;
+    else
+        usage(argv[0]);
+    if (strcmp(model, "bimodal") == 0)
+        cbp_cfg.model = CBP_BIMODAL;
+    else if (strcmp(model, "gshare") == 0)
+        cbp_cfg.model = CBP_GSHARE;
+    else if (strcmp(model, "tage") == 0)
+        cbp_cfg.model = CBP_TAGE;
+    else if (strcmp(model, "perceptron") == 0)
+        cbp_cfg.model = CBP_PERCEPTRON;
+    else
+        usage(argv[0]);
+    if (strcmp(update, "cond") == 0)
+        cbp_cfg.update = CBP_UPDATE_COND;
+    else if (strcmp(update, "all") == 0)
+        cbp_cfg.update = CBP_UPDATE_ALL;
+    else if (strcmp(update, "path") == 0)
+        cbp_cfg.update = CBP_UPDATE_PATH;
+    else
+        usage(argv[0]);
+
+    struct trace t;
+    struct trace_cursor c;
+    struct trace_record r;
+    uint64_t n = 0;
+
+    trace_open(&t, path);
+    printf("Trace: %lu records in %u blocks, %zu bytes (%.2f bytes per record)\n", (unsigned long)t.header->records,
+           t.header->blocks, t.size, t.header->records ? (double)t.size / t.header->records : 0.0);
+    trace_seek(&t, &c, 0, t.header->blocks);
+
+    if (dump)
+    {
+        while ((!max_records || n < max_records) && trace_next(&c, &r))
+        {
+            printf("%lu %#lx -> %#lx %s%s\n", (unsigned long)n, (unsigned long)r.pc, (unsigned long)r.target,
+                   kind_names[r.kind], r.kind == TRACE_COND ? (r.taken ? " taken" : " not taken") : "");
+            n++;
+        }
+        trace_close(&t);
+        return 0;
+    }
+
+    struct btb btb;
+    struct cbp cbp;
+    long taken = 0;
+
+    btb_init(&btb, &btb_cfg);
+    cbp_init(&cbp, &cbp_cfg);
+
+    double start = now();
+    while ((!max_records || n < max_records) && trace_next(&c, &r))
+    {
+        if (r.taken)
+        {
+            btb_access(&btb, r.pc, r.target);
+            taken++;
+        }
+        cbp_branch(&cbp, r.pc, r.target, r.kind == TRACE_COND, r.taken);
+        n++;
+    }
+    double seconds = now() - start;
+
+    printf("BTB (%d sets x %d ways, index from bit %d (%s), %d tag bits, %s): %ld misses of %ld taken branches "
+           "(%.2f%%)\n",
+           btb_cfg.sets, btb_cfg.ways, btb_cfg.index_shift, hash, btb_cfg.tag_bits, policy, btb.misses, taken,
+           taken ? 100.0 * btb.misses / taken : 0.0);
+    printf("Predictor (%s, 2^%d entries, %d history bits, %s history): %ld mispredicts of %ld conditional branches "
+           "(%.2f%%)\n",
+           model, cbp_cfg.table_bits, cbp_cfg.history, update, cbp.mispredicts, cbp.conditionals,
+           cbp.conditionals ? 100.0 * cbp.mispredicts / cbp.conditionals : 0.0);
+    printf("Replayed %lu records in %.3f s: %.1f M records/s\n", (unsigned long)n, seconds,
+           seconds > 0 ? n / seconds / 1e6 : 0.0);
+
+    struct sink sink;
+    sink_open(&sink, results_path, results_format);
+    int col_records = sink_column(&sink, "records", SINK_INT);
+    int col_taken = sink_column(&sink, "taken", SINK_INT);
+    int col_btb_misses = sink_column(&sink, "btb_misses", SINK_INT);
+    int col_conditionals = sink_column(&sink, "conditionals", SINK_INT);
+    int col_mispredicts = sink_column(&sink, "mispredicts", SINK_INT);
+    int col_seconds = sink_column(&sink, "seconds", SINK_FLOAT);
+    sink_meta_system(&sink, 0, argc, argv);
+    sink_meta(&sink, "experiment", "replay");
+    sink_meta(&sink, "trace", "%s", path);
+    sink_meta(&sink, "btb", "sets=%d ways=%d index_shift=%d tag_bits=%d hash=%s policy=%s", btb_cfg.sets,
+              btb_cfg.ways, btb_cfg.index_shift, btb_cfg.tag_bits, hash, policy);
+    sink_meta(&sink, "predictor", "model=%s table_bits=%d history=%d min_history=%d tables=%d tag_bits=%d update=%s",
+              model, cbp_cfg.table_bits, cbp_cfg.history, cbp_cfg.min_history, cbp_cfg.tables, cbp_cfg.tag_bits,
+              update);
+    sink_start(&sink);
+    sink_int(&sink, col_records, n);
+    sink_int(&sink, col_taken, taken);
+    sink_int(&sink, col_btb_misses, btb.misses);
+    sink_int(&sink, col_conditionals, cbp.conditionals);
+    sink_int(&sink, col_mispredicts, cbp.mispredicts);
+    sink_float(&sink, col_seconds, seconds);
+    sink_emit(&sink);
+    sink_close(&sink);
+
+    btb_free(&btb);
+    cbp_free(&cbp);
+    trace_close(&t);
+    return 0;
+}
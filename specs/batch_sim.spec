@@ -0,0 +1,10 @@
+# Every gshare table size x history length over one trace, many configurations per pass
+experiment = batch_sim
+trace = cbp_sim.bpt
+table_bits = 8..16
+history = 0..32:2
+update = cond
+kernel = auto
+results = batch_sim.csv
+# max_records = 10000000
+# check = yes
@@ -0,0 +1,17 @@
+# BTB index bits: copies of one branch spaced 2^index_bits bytes apart
+experiment = btb_index
+index_bits = 4..26
+copies = 17
+cpu = 0
+# cpus = all
+# reserve = yes
+timer = auto
+trials = 10000
+rel_err = 0.01
+perturb = sw
+address = 0x10000000
+# results = btb_index.csv
+# format = csv
+# store = btb_index.store
+# force = yes
+# refine = 0.1
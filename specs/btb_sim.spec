@@ -0,0 +1,16 @@
+# Software BTB replaying the BTB/Ways layouts; bpure analyze on the results should give back `ways`
+experiment = btb_sim
+layout = ways
+values = 2..20
+stride_bits = 26
+sets = 64
+ways = 4
+index_shift = 2
+tag_bits = 0
+hash = bits
+policy = lru
+penalty = 8
+results = btb_sim.csv
+# object = BTB/Ways/branch.o
+# verbose = yes
+# trace = btb_sim.bpt
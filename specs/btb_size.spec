@@ -0,0 +1,15 @@
+# BTB capacity: loops of always-taken branches at a given distance
+experiment = btb_size
+distances = 16..64*2
+branches = 512..8192*2
+iterations = 1000000
+repeats = 3
+cpu = 0
+# cpus = all
+# reserve = yes
+timer = auto
+# results = btb_size.csv
+# format = csv
+# store = btb_size.store
+# force = yes
+# refine = 0.1
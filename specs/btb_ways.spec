@@ -0,0 +1,17 @@
+# BTB associativity: 2..20 branches aliasing in one set
+experiment = btb_ways
+branch_nums = 2..20
+stride_bits = 26
+cpu = 0
+# cpus = all
+# reserve = yes
+timer = auto
+trials = 10000
+rel_err = 0.01
+perturb = sw
+address = 0x10000000
+# results = btb_ways.csv
+# format = csv
+# store = btb_ways.store
+# force = yes
+# refine = 0.1
@@ -0,0 +1,18 @@
+# Predictor model replaying ghr_len's branch stream. With conditional-only history and ghr_len's loop
+# branch in the stream, the train branch stays visible up to history - 2 = 10 dummies, which bpure analyze
+# on the results should give back
+experiment = cbp_sim
+model = gshare
+table_bits = 12
+history = 12
+update = cond
+harness = all
+dummies = 0..49
+trials = 10000
+warmup = 2000
+results = cbp_sim.csv
+# min_history = 4
+# tables = 6
+# tag_bits = 9
+# object = CBP/branch.o
+# trace = cbp_sim.bpt
@@ -0,0 +1,17 @@
+# BTB geometries and gshare sizes over several traces, spread over every CPU with work stealing
+experiment = dse
+traces = cbp_sim.bpt,btb_sim.bpt
+family = both
+sets = 16..4096*2
+ways = 1,2,4,8
+hash = bits,xor
+model = gshare
+table_bits = 8..16:2
+history = 0..32:4
+update = cond
+cpus = all
+chunk_blocks = 16
+warmup_blocks = 1
+results = dse.csv
+# chunk_blocks = 0
+# reserve = yes
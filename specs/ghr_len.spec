@@ -0,0 +1,12 @@
+# Global history length: train branch, k dummy branches, test branch
+experiment = ghr_len
+cpu = 0
+timer = auto
+mode = time
+dummies = 0..49
+trials = 10000
+rel_err = 0.01
+perturb = sw
+address = 0x10000000
+# results = ghr_len.csv
+# format = csv
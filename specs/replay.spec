@@ -0,0 +1,15 @@
+# Replay a branch trace written with `trace = ...` by btb_sim or cbp_sim through a BTB and a predictor
+experiment = replay
+trace = cbp_sim.bpt
+sets = 64
+ways = 4
+index_shift = 2
+hash = bits
+policy = lru
+model = gshare
+table_bits = 12
+history = 12
+update = cond
+results = replay.csv
+# max_records = 1000000
+# dump = yes
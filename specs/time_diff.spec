@@ -0,0 +1,12 @@
+# Predictable vs unpredictable conditional branch latency
+experiment = time_diff
+cpu = 0
+timer = auto
+mode = time
+batch_target = 64   # ticks per timed window; 0 times one branch per window
+trials = 10000
+rel_err = 0.01
+perturb = sw
+address = 0x80000000
+# results = time_diff.csv
+# format = csv
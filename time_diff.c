@@ -1,242 +1,390 @@
-#define _GNU_SOURCE
-
 #include <err.h>
-#include <fcntl.h>
-#include <gelf.h>
-#include <libelf.h>
-#include <sched.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/mman.h>
 #include <time.h>
 #include <unistd.h>
 
-#define TRIALS 10000
+#include "bpure.h"
+#include "classify.h"
+#include "hist.h"
+#include "measure.h"
+#include "perturb.h"
+#include "pmu.h"
+#include "sink.h"
+#include "timer.h"
+#include "trials.h"
+
+#define MAX_BATCH 1024
+#define LABEL_NONE -2 // Sink label of windows of several branches, or when nothing could be fitted
 
 #define TARGET_ADDRESS 0x80000000   // mmap needs the address to be aligned to a page boundary
 #define BEQ_OFFSET 0x10  // Offset of the branch instruction in the binary
 #define TARGET_BRANCH_ADDRESS (TARGET_ADDRESS + BEQ_OFFSET) // Address of the branch instruction
 
 void (*perform_branch)(int);
+struct timer timer;
+struct overhead overhead;
+struct pmu pmu;
+struct code_arena arena; // Holds perform_branch
+struct perturb perturb;
+struct sink sink;
+int use_pmu = 0; // Count mispredicts instead of inferring them from latency
+int batch = 1;   // Replicas of the branch in one timed window
+int conds[MAX_BATCH];
+struct hist hists[2];        // Predictable and unpredictable windows
+struct hist merged;          // Both, for fitting the hit and miss populations
+struct hist single_hists[2]; // The classification pass of a batched run, one branch per window
+uint64_t *kept[2];           // Windows of every kept trial of every pass, for the sink rows
+int *kept_branches;          // Branches in each kept trial's windows
+long num_kept, kept_size;
+int col_trial, col_branches, col_predictable, col_unpredictable, col_predictable_label, col_unpredictable_label;
 
-void load_function(const char *filename, const char *func_name)
+void train_branch_predictor(int iterations, int condition)
 {
-    if (elf_version(EV_CURRENT) == EV_NONE)
-    {
-        fprintf(stderr, "ELF library initialization failed: %s\n", elf_errmsg(-1));
-        exit(EXIT_FAILURE);
-    }
-
-    int fd = open(filename, O_RDONLY);
-    if (fd < 0)
+    for (int i = 0; i < iterations; i++)
     {
-        perror("open");
-        exit(EXIT_FAILURE);
+        perform_branch(condition);
     }
+}
 
-    Elf *e = elf_begin(fd, ELF_C_READ, NULL);
-    if (!e)
-    {
-        fprintf(stderr, "elf_begin() failed: %s\n", elf_errmsg(-1));
-        close(fd);
-        exit(EXIT_FAILURE);
-    }
+// Time one window of `batch` calls to perform_branch, replica r taking conds[r]
+uint64_t measure_batch_time(void)
+{
+    uint64_t start_time, end_time;
 
-    Elf_Scn *scn = NULL;
-    GElf_Shdr shdr;
-    while ((scn = elf_nextscn(e, scn)) != NULL)
-    {
-        gelf_getshdr(scn, &shdr);
-        if (shdr.sh_type == SHT_SYMTAB)
-        {
-            Elf_Data *data = elf_getdata(scn, NULL);
-            int count = shdr.sh_size / shdr.sh_entsize;
-            for (int i = 0; i < count; ++i)
-            {
-                GElf_Sym sym;
-                gelf_getsym(data, i, &sym);
-                if (strcmp(func_name, elf_strptr(e, shdr.sh_link, sym.st_name)) == 0)
-                {
-                    printf("Symbol name: %s\n", func_name);
-                    printf("Symbol size: %zu\n", sym.st_size);
-
-                    // Find the section containing the symbol
-                    Elf_Scn *sym_scn = elf_getscn(e, sym.st_shndx);
-                    GElf_Shdr sym_shdr;
-                    gelf_getshdr(sym_scn, &sym_shdr);
-
-                    // Calculate the file offset of the symbol
-                    off_t offset = sym_shdr.sh_offset + (sym.st_value - sym_shdr.sh_addr);
-                    printf("Symbol offset: %ld\n", offset);
-
-                    // Ensure memory alignment
-                    size_t aligned_size = (sym.st_size + 3) & ~3;
-                    void *mem = mmap((void *)TARGET_ADDRESS, aligned_size, PROT_READ | PROT_WRITE | PROT_EXEC,
-                                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
-                    if (mem == MAP_FAILED)
-                    {
-                        perror("mmap");
-                        elf_end(e);
-                        close(fd);
-                        exit(EXIT_FAILURE);
-                    }
-
-                    lseek(fd, offset, SEEK_SET);
-                    ssize_t bytes_read = read(fd, mem, sym.st_size);
-                    if (bytes_read != sym.st_size)
-                    {
-                        fprintf(stderr, "Failed to read function code: expected %zu bytes, got %zd bytes\n", sym.st_size, bytes_read);
-                        elf_end(e);
-                        close(fd);
-                        exit(EXIT_FAILURE);
-                    }
-
-                    printf("Read content:\n");
-                    for (ssize_t j = 0; j < bytes_read; ++j)
-                    {
-                        printf("%02x ", ((unsigned char *)mem)[j]);
-                    }
-                    printf("\n");
-
-                    // Clear instruction cache
-                    __builtin___clear_cache(mem, (char *)mem + sym.st_size);
-
-                    perform_branch = (void (*)(int))mem;
-                    break;
-                }
-            }
-            break;
-        }
-    }
+    start_time = timer_read(&timer);
+    for (int r = 0; r < batch; r++)
+        perform_branch(conds[r]);
+    end_time = timer_read(&timer);
 
-    elf_end(e);
-    close(fd);
+    return end_time - start_time;
 }
 
-// Function to bind the process to a specific CPU
-void bind_to_cpu(int cpu)
+// Every replica goes the direction the predictor was trained for
+uint64_t measure_predictable_time(void *ctx)
 {
-    cpu_set_t set;
-    CPU_ZERO(&set);
-    CPU_SET(cpu, &set);
-    if (sched_setaffinity(0, sizeof(set), &set) < 0)
-        err(EXIT_FAILURE, "Unable to set CPU affinity");
+    for (int r = 0; r < batch; r++)
+        conds[r] = 1;
+    return measure_batch_time();
 }
 
-// Function to get current time; similar to rdtscp
-__attribute__((always_inline)) inline uint64_t read_cntvct(void)
+uint64_t measure_unpredictable_time(void)
 {
-    uint64_t val;
-    asm volatile("dsb ish" ::: "memory");
-    asm volatile("mrs %0, cntvct_el0" : "=r"(val)); // Barrier before and after reading the counter
-    asm volatile("dsb ish" ::: "memory");
-    return val;
+    for (int r = 0; r < batch; r++)
+        conds[r] = (int)xrand() % 2;
+    return measure_batch_time();
 }
 
-//////////////////////////////////////////////
-// xorshift128+ by Sebastiano Vigna
-// from http://xorshift.di.unimi.it/xorshift128plus.c
-uint64_t s[2] = {0, 1};
-
-__attribute__((always_inline)) inline uint64_t xrand(void)
+// The reads have no branches of their own, so nothing runs between training and the branch but its call
+uint64_t measure_single_branch_misses(int condition)
 {
-    uint64_t s1 = s[0];
-    const uint64_t s0 = s[1];
-    s[0] = s0;
-    s1 ^= s1 << 23;                          // a
-    s[1] = s1 ^ s0 ^ (s1 >> 18) ^ (s0 >> 5); // b, c
-    return s[1] + s0;
+    uint64_t start, end;
+
+    start = pmu_read_misses(&pmu);
+    perform_branch(condition);
+    end = pmu_read_misses(&pmu);
+
+    return end - start;
 }
 
-// splitmix64 generator -- http://xorshift.di.unimi.it/splitmix64.c
-void xsrand(uint64_t x)
+// Sample both series until trials_done_pair, dropping perturbed trials; every kept pair is also appended
+// to kept for its sink row. Returns the pairs kept.
+long run_trials(struct trials *tc, struct welford stats[2], struct hist h[2])
 {
-    for (int i = 0; i <= 1; i++)
+    struct perturb_counts perturbation;
+    uint64_t time_diff[2];
+    long trials = 0, attempts = 0;
+
+    for (int k = 0; k < 2; k++)
     {
-        uint64_t z = (x += UINT64_C(0x9E3779B97F4A7C15));
-        z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
-        z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
-        s[i] = z ^ (z >> 31);
+        welford_init(&stats[k]);
+        hist_init(&h[k]);
     }
-}
-/////////////////////////////////////
 
-void train_branch_predictor(int iterations, int condition)
-{
-    for (int i = 0; i < iterations; i++)
+    while (!trials_done_pair(tc, &stats[0], &stats[1]) &&
+           !perturb_give_up(&perturb, &attempts, trials_max_attempts(tc)))
     {
-        perform_branch(condition);
+        int rand = (int)xrand() % 2;
+
+        // Read the perturbation counters first: a syscall after training would disturb the predictor
+        perturb_begin(&perturb, &perturbation);
+
+        // Train the branch predictor with condition == 1
+        train_branch_predictor(100, 1);
+
+        // Measure branch with condition == 1 (same direction as training)
+        time_diff[0] = use_pmu ? measure_single_branch_misses(1) : measure_predictable_time(NULL);
+
+        // Measure unpredictable branch
+        time_diff[1] = use_pmu ? measure_single_branch_misses(rand) : measure_unpredictable_time();
+
+        if (perturb_end(&perturb, &perturbation))
+            continue;
+
+        for (int k = 0; k < 2; k++)
+        {
+            welford_add(&stats[k], time_diff[k]);
+            hist_record(&h[k], time_diff[k]);
+        }
+
+        if (num_kept == kept_size)
+        {
+            kept_size = kept_size ? 2 * kept_size : 4096;
+            kept[0] = realloc(kept[0], kept_size * sizeof(uint64_t));
+            kept[1] = realloc(kept[1], kept_size * sizeof(uint64_t));
+            kept_branches = realloc(kept_branches, kept_size * sizeof(int));
+            if (!kept[0] || !kept[1] || !kept_branches)
+                err(EXIT_FAILURE, "Unable to keep the trials");
+        }
+        kept[0][num_kept] = time_diff[0];
+        kept[1][num_kept] = time_diff[1];
+        kept_branches[num_kept] = batch;
+        num_kept++;
+        trials++;
     }
+    return trials;
 }
 
-uint64_t measure_single_branch_time(int condition)
+// Sink row of kept trial i with the labels of its two windows
+void emit_trial(long i, int predictable_label, int unpredictable_label)
 {
-    uint64_t start_time, end_time;
-
-    start_time = read_cntvct();
-    perform_branch(condition);
-    end_time = read_cntvct();
-
-    return end_time - start_time;
+    sink_int(&sink, col_trial, i);
+    sink_int(&sink, col_branches, kept_branches[i]);
+    sink_int(&sink, col_predictable, kept[0][i]);
+    sink_int(&sink, col_unpredictable, kept[1][i]);
+    sink_int(&sink, col_predictable_label, predictable_label);
+    sink_int(&sink, col_unpredictable_label, unpredictable_label);
+    sink_emit(&sink);
 }
 
-int main()
+void finish(void)
 {
-    uint64_t time_diff;
-    int rand;
-    int results[TRIALS][2];
-    int total_branch_time[2];
+    perturb_report(&perturb, stdout);
+    perturb_close(&perturb);
+    sink_close(&sink);
+    arena_release(&arena);
+}
 
-    // Load the function containing the branch instruction
-    load_function("branch.o", "perform_branch");
-    if (perform_branch)
-        printf("perform_branch is loaded to %p\n", perform_branch);
-    else
+int main(int argc, char **argv)
+{
+    struct trials tc;
+    struct welford stats[2];
+    long max_trials = TRIALS_MAX;
+    double rel_err = TRIALS_REL_ERR;
+    const char *perturb_mode = "sw";
+    uintptr_t target_address = TARGET_ADDRESS;
+    void *entry;
+    const char *timer_name = "auto";
+    double batch_target = BATCH_TARGET_TICKS;
+    uint64_t seed = time(NULL);
+    const char *results_path = NULL, *results_format = NULL;
+    int cpu = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "a:c:t:m:B:n:e:P:S:o:f:")) != -1)
     {
-        fprintf(stderr, "Failed to load function\n");
-        return EXIT_FAILURE;
+        switch (opt)
+        {
+        case 'a':
+            target_address = strtoull(optarg, NULL, 0);
+            break;
+        case 'c':
+            cpu = atoi(optarg);
+            break;
+        case 't':
+            timer_name = optarg;
+            break;
+        case 'm':
+            use_pmu = strcmp(optarg, "pmu") == 0;
+            break;
+        case 'B':
+            batch_target = atof(optarg);
+            break;
+        case 'n':
+            max_trials = atol(optarg);
+            break;
+        case 'e':
+            rel_err = atof(optarg);
+            break;
+        case 'P':
+            perturb_mode = optarg;
+            break;
+        case 'S':
+            seed = strtoull(optarg, NULL, 0);
+            break;
+        case 'o':
+            results_path = optarg;
+            break;
+        case 'f':
+            results_format = optarg;
+            break;
+        default:
+            fprintf(stderr,
+                    "Usage: %s [-a address] [-c cpu] [-t timer] [-m time|pmu] [-B batch_target_ticks] [-n max_trials] "
+                    "[-e rel_err] [-P none|sw|irq|all] [-S seed] [-o results [-f csv|jsonl|bin]]\n",
+                    argv[0]);
+            return EXIT_FAILURE;
+        }
     }
 
-    // Bind the process to CPU 0
-    bind_to_cpu(0);
-
-    // Random # generator
-    xsrand(time(NULL));
+    // Load the function containing the branch instruction
+    bpure_verbose = 1;
+    load_function(&arena, "branch.o", "perform_branch", target_address, 0, 1, &entry);
+    perform_branch = (void (*)(int))entry;
+    printf("perform_branch is loaded to %p\n", perform_branch);
 
-    for (int iteration = 0; iteration < TRIALS; iteration++)
-    {
-        rand = (int)xrand() % 2;
+    // Bind the process to the requested CPU
+    bind_to_cpu(cpu);
 
-        // Train the branch predictor with condition == 1
-        train_branch_predictor(100, 1);
+    // Drop trials that a context switch, migration, page fault or interrupt landed in
+    perturb_open(&perturb, perturb_mode, cpu);
 
-        // Measure time for branch with condition == 1 (same direction as training)
-        time_diff = measure_single_branch_time(1);
-        results[iteration][0] = (int)time_diff;
+    // Calibrate the timer on the CPU it will be read on
+    timer_open_named(&timer, timer_name);
+    timer_report(&timer, stdout);
 
-        // Measure time for unpredictable branch
-        time_diff = measure_single_branch_time(rand);
-        results[iteration][1] = (int)time_diff;
+    // Count branch misses directly when the kernel exposes the PMU, otherwise fall back to timing
+    if (use_pmu && pmu_open(&pmu) < 0)
+    {
+        fprintf(stderr, "PMU not available, falling back to timing\n");
+        use_pmu = 0;
     }
-
-    for (int i = 0; i < TRIALS; i++)
+    // A syscall between training and the measured branch would run kernel branches through the predictor
+    if (use_pmu && !pmu.user_read)
     {
-        total_branch_time[0] += results[i][0];
-        total_branch_time[1] += results[i][1];
+        fprintf(stderr, "PMU counters cannot be read from user space, falling back to timing\n");
+        pmu_close(&pmu);
+        use_pmu = 0;
     }
+    if (use_pmu)
+        printf("Counting branch misses\n");
+
+    // Random # generator
+    xsrand(seed);
 
-    double avg_time_unpredictable = (double)total_branch_time[1] / TRIALS;
-    int unpredictable_branches_below_avg = 0;
+    if (!use_pmu)
+    {
+        // Replicate the branch until a window spans enough ticks to beat the counter resolution
+        if (batch_target > 0)
+            batch_choose(&timer, measure_predictable_time, NULL, &batch, batch_target, MAX_BATCH);
+        printf("Batch: %d branches per timed window\n", batch);
+
+        // Time the same calls through the pointer with an empty gadget in place of the branch
+        perform_branch = (void (*)(int))empty_gadget();
+        overhead_calibrate(&overhead, measure_predictable_time, NULL, OVERHEAD_SAMPLES);
+        perform_branch = (void (*)(int))entry;
+        overhead_report(&overhead, &timer, stdout);
+    }
 
-    for (int i = 0; i < TRIALS; i++)
-        if (results[i][1] < avg_time_unpredictable)
-            unpredictable_branches_below_avg++;
+    // One record per kept trial: window ticks, or branch misses with -m pmu, and each window's label
+    sink_open(&sink, results_path, results_format);
+    col_trial = sink_column(&sink, "trial", SINK_INT);
+    col_branches = sink_column(&sink, "branches", SINK_INT);
+    col_predictable = sink_column(&sink, "predictable", SINK_INT);
+    col_unpredictable = sink_column(&sink, "unpredictable", SINK_INT);
+    col_predictable_label = sink_column(&sink, "predictable_label", SINK_INT);
+    col_unpredictable_label = sink_column(&sink, "unpredictable_label", SINK_INT);
+    sink_meta_system(&sink, cpu, argc, argv);
+    sink_meta(&sink, "experiment", "time_diff");
+    sink_meta(&sink, "mode", "%s", use_pmu ? "pmu" : "time");
+    sink_meta(&sink, "timer", "%s", timer.name);
+    sink_meta(&sink, "ns_per_tick", "%g", timer.ns_per_tick);
+    sink_meta(&sink, "cpu", "%d", cpu);
+    sink_meta(&sink, "address", "%#lx", (unsigned long)target_address);
+    sink_meta(&sink, "batch", "%d", batch);
+    sink_meta(&sink, "overhead_ticks", "%g", use_pmu ? 0 : overhead.median);
+    sink_meta(&sink, "max_trials", "%ld", max_trials);
+    sink_meta(&sink, "rel_err", "%g", rel_err);
+    sink_meta(&sink, "perturb", "%s", perturb_mode);
+    sink_meta(&sink, "seed", "%lu", seed);
+    sink_meta(&sink, "labels", "0 predicted, 1 mispredicted, -1 outlier, %d unlabelled", LABEL_NONE);
+    sink_start(&sink);
+
+    // Sample until both means are known to rel_err, running on while the two distributions overlap
+    trials_init(&tc, max_trials, rel_err);
+    long trials = run_trials(&tc, stats, hists);
+    printf("Trials: %ld (%s)\n", trials, welford_separated(&stats[0], &stats[1]) ? "separated" : "overlapping");
+
+    if (use_pmu)
+    {
+        uint64_t unpredictable_branches_predicted = hist_count_below(&hists[1], 1);
+
+        printf("Average mispredicts for predictable branch: %f\n", stats[0].mean);
+        printf("Average mispredicts for unpredictable branch: %f\n", stats[1].mean);
+        printf("Correct prediction rate for unpredictable branch: %f%%\n", (double)unpredictable_branches_predicted / trials * 100);
+
+        // The counter labels every trial itself
+        for (long i = 0; i < num_kept; i++)
+            emit_trial(i, kept[0][i] > 0, kept[1][i] > 0);
+        finish();
+        pmu_close(&pmu);
+        return 0;
+    }
 
-    printf("Average time for predictable branch: %f\n", (double)total_branch_time[0] / TRIALS);
-    printf("Average time for unpredictable branch: %f\n", avg_time_unpredictable);
-    printf("Correct prediction rate for unpredictable branch: %f%%\n", (double)unpredictable_branches_below_avg / TRIALS * 100);
+    // Windows hold `batch` branches; report per branch
+    double avg_time_predictable = stats[0].mean;
+    double avg_time_unpredictable = stats[1].mean;
+    printf("Average time for predictable branch: %f (net %f)\n", avg_time_predictable / batch,
+           overhead_net(&overhead, avg_time_predictable) / batch);
+    printf("Average time for unpredictable branch: %f (net %f)\n", avg_time_unpredictable / batch,
+           overhead_net(&overhead, avg_time_unpredictable) / batch);
+    printf("Median window: predictable %.1f, unpredictable %.1f ticks; p99 %.1f, %.1f\n",
+           hist_percentile(&hists[0], 50), hist_percentile(&hists[1], 50), hist_percentile(&hists[0], 99),
+           hist_percentile(&hists[1], 99));
+
+    // Windows of several random branches mix hit and miss counts, so only single branches are labelled: a
+    // batched run takes a second pass of one branch per window for the fit
+    struct welford single_stats[2];
+    struct hist *fit_hists = hists;
+    long first_single = 0;
+    if (batch > 1)
+    {
+        for (long i = 0; i < num_kept; i++)
+            emit_trial(i, LABEL_NONE, LABEL_NONE);
+        first_single = num_kept;
+
+        batch = 1;
+        printf("Classification pass: one branch per window\n");
+        trials_init(&tc, max_trials, rel_err);
+        trials = run_trials(&tc, single_stats, single_hists);
+        printf("Trials: %ld (%s)\n", trials,
+               welford_separated(&single_stats[0], &single_stats[1]) ? "separated" : "overlapping");
+        fit_hists = single_hists;
+    }
 
+    // Fit the hit and miss populations over both series; the predictable one anchors the fast mode
+    struct classify fit;
+    hist_init(&merged);
+    hist_merge(&merged, &fit_hists[0]);
+    hist_merge(&merged, &fit_hists[1]);
+    if (classify_fit(&fit, &merged) < 0)
+    {
+        printf("Windows take a single value, nothing to classify\n");
+        for (long i = first_single; i < num_kept; i++)
+            emit_trial(i, LABEL_NONE, LABEL_NONE);
+        finish();
+        return 0;
+    }
+    classify_report(&fit, stdout);
+
+    // Every window's label depends only on its value, so the counts come from the histograms
+    uint64_t predictable_hits = classify_count(&fit, &fit_hists[0], 0);
+    uint64_t predictable_misses = classify_count(&fit, &fit_hists[0], 1);
+    uint64_t unpredictable_hits = classify_count(&fit, &fit_hists[1], 0);
+    uint64_t unpredictable_misses = classify_count(&fit, &fit_hists[1], 1);
+
+    printf("Mispredict penalty: %.1f ticks (%f ns)\n", fit.mode[1] - fit.mode[0],
+           (fit.mode[1] - fit.mode[0]) * timer.ns_per_tick);
+    printf("Predictable trials labelled mispredicted: %lu of %lu\n", predictable_misses,
+           predictable_hits + predictable_misses);
+    printf("Correct prediction rate for unpredictable branch: %f%% (%lu of %lu)%s\n",
+           100.0 * unpredictable_hits / (unpredictable_hits + unpredictable_misses), unpredictable_hits,
+           unpredictable_hits + unpredictable_misses, fit.resolved ? "" : ", modes overlap");
+
+    for (long i = first_single; i < num_kept; i++)
+        emit_trial(i, classify_label(&fit, kept[0][i]), classify_label(&fit, kept[1][i]));
+    finish();
     return 0;
-}
\ No newline at end of file
+}